@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited. All rights reserved.
  * Copyright (c) 2022 Cypress Semiconductor Corporation (an Infineon company)
  * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
@@ -18,6 +18,9 @@
 #ifdef TFM_NS_MAILBOX_API
 #include "tfm_multi_core_api.h"
 #include "tfm_ns_mailbox.h"
+#ifndef TFM_MULTI_CORE_NS_OS_MAILBOX_THREAD
+#include "tfm_ns_mailbox_batch.h"
+#endif
 #endif
 #include "tfm_log.h"
 #include "uart_stdout.h"
@@ -67,6 +70,35 @@ static const osThreadAttr_t mailbox_thread_attr = {
 };
 #endif
 
+#ifdef TFM_NS_LOG_DEFERRED
+/* Period of the output of the deferred log messages, in RTOS ticks */
+#define LOG_THREAD_PERIOD_TICKS    10U
+
+/* Set by the build, which accounts for it in the RTX heap */
+#ifndef LOG_THREAD_STACK_SIZE
+#define LOG_THREAD_STACK_SIZE      768U
+#endif
+
+/**
+ * \brief Outputs the deferred log messages when no other thread is running
+ */
+static void log_thread_func(void *argument)
+{
+    (void)argument;
+
+    for (;;) {
+        tfm_log_flush();
+        (void) osDelay(LOG_THREAD_PERIOD_TICKS);
+    }
+}
+
+static const osThreadAttr_t log_thread_attr = {
+    .name = "log_thread",
+    .stack_size = LOG_THREAD_STACK_SIZE,
+    .priority = osPriorityLow
+};
+#endif
+
 #ifdef TFM_NS_MAILBOX_API
 static struct ns_mailbox_queue_t ns_mailbox_queue;
 
@@ -92,6 +124,17 @@ static void tfm_ns_multi_core_boot(void)
         for (;;) {
         }
     }
+
+#ifndef TFM_MULTI_CORE_NS_OS_MAILBOX_THREAD
+    ret = tfm_ns_mailbox_batch_init(&ns_mailbox_queue);
+    if (ret != MAILBOX_SUCCESS) {
+        LOG_MSG("Non-secure mailbox batch initialization failed.\r\n");
+
+        /* Avoid undefined behavior after NS mailbox initialization failed */
+        for (;;) {
+        }
+    }
+#endif
 }
 #else /* TFM_NS_MAILBOX_API */
 extern uint32_t tfm_ns_interface_init(void);
@@ -169,6 +212,10 @@ int main(void)
 
     (void) osThreadNew(thread_func, NULL, &thread_attr);
 
+#ifdef TFM_NS_LOG_DEFERRED
+    (void) osThreadNew(log_thread_func, NULL, &log_thread_attr);
+#endif
+
     LOG_MSG("Non-Secure system starting...\r\n");
     (void) osKernelStart();
 
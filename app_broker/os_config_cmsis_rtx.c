@@ -1,12 +1,16 @@
 /*
- * Copyright (c) 2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
+#include <stddef.h>
 #include "cmsis_compiler.h"
 #include "rtx_os.h"
+#if defined(TFM_NS_MANAGE_NSID) && defined(TFM_NS_NSID_LAZY_CONTEXT)
+#include "tfm_nsid_manager.h"
+#endif
 
 /* This is an example OS configuration implementation for CMSIS-RTX */
 
@@ -21,3 +25,16 @@ __NO_RETURN void osRtxIdleThread(void *argument)
         __WFE();
     }
 }
+
+#if defined(TFM_NS_MANAGE_NSID) && defined(TFM_NS_NSID_LAZY_CONTEXT)
+/*
+ * RTX selects the thread to switch in before it stores the context of the
+ * running thread, and records the secure context of each thread in tz_memory.
+ */
+bool nsid_mgr_next_thread_has_context(void)
+{
+    const osRtxThread_t *next = osRtxInfo.thread.run.next;
+
+    return (next != NULL) && (next->tz_memory != 0U);
+}
+#endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -180,6 +180,21 @@ void os_wrapper_thread_exit(void)
     osThreadExit();
 }
 
+/*
+ * The threads are created detached, so RTX deletes them when they exit and
+ * can reuse their handles for new threads. The handle is not looked up: the
+ * caller has synchronized with the end of the thread, and there is nothing
+ * left to release.
+ */
+uint32_t os_wrapper_thread_join(void *handle)
+{
+    if (!handle || ((osThreadId_t)handle == osThreadGetId())) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    return OS_WRAPPER_SUCCESS;
+}
+
 uint32_t os_wrapper_thread_set_flag(void *handle, uint32_t flags)
 {
     uint32_t ret;
@@ -238,10 +253,28 @@ void *os_wrapper_msg_queue_create(size_t msg_size, uint8_t msg_count)
 
 int32_t os_wrapper_msg_queue_send(void *mq_handle,
                                   const void *msg_ptr)
+{
+    return os_wrapper_msg_queue_send_timeout(mq_handle, msg_ptr, 0, 0);
+}
+
+int32_t os_wrapper_msg_queue_send_prio(void *mq_handle,
+                                       const void *msg_ptr,
+                                       uint8_t priority)
+{
+    return os_wrapper_msg_queue_send_timeout(mq_handle, msg_ptr, priority, 0);
+}
+
+int32_t os_wrapper_msg_queue_send_timeout(void *mq_handle,
+                                          const void *msg_ptr,
+                                          uint8_t priority,
+                                          uint32_t timeout)
 {
     osStatus_t status;
 
-    status = osMessageQueuePut(mq_handle, msg_ptr, 0, 0);
+    /* RTX queues the messages in order of priority */
+    status = osMessageQueuePut(mq_handle, msg_ptr, priority,
+                               (timeout == OS_WRAPPER_WAIT_FOREVER) ?
+                               osWaitForever : timeout);
     if (status == osOK) {
         return OS_WRAPPER_SUCCESS;
     }
@@ -251,10 +284,32 @@ int32_t os_wrapper_msg_queue_send(void *mq_handle,
 
 int32_t os_wrapper_msg_queue_receive(void *mq_handle,
                                      void *msg_ptr)
+{
+    return os_wrapper_msg_queue_receive_timeout(mq_handle, msg_ptr,
+                                                OS_WRAPPER_WAIT_FOREVER);
+}
+
+int32_t os_wrapper_msg_queue_receive_timeout(void *mq_handle,
+                                             void *msg_ptr,
+                                             uint32_t timeout)
+{
+    osStatus_t status;
+
+    status = osMessageQueueGet(mq_handle, msg_ptr, NULL,
+                               (timeout == OS_WRAPPER_WAIT_FOREVER) ?
+                               osWaitForever : timeout);
+    if (status == osOK) {
+        return OS_WRAPPER_SUCCESS;
+    }
+
+    return OS_WRAPPER_ERROR;
+}
+
+int32_t os_wrapper_msg_queue_delete(void *mq_handle)
 {
     osStatus_t status;
 
-    status = osMessageQueueGet(mq_handle, msg_ptr, NULL, osWaitForever);
+    status = osMessageQueueDelete(mq_handle);
     if (status == osOK) {
         return OS_WRAPPER_SUCCESS;
     }
@@ -0,0 +1,180 @@
+#-------------------------------------------------------------------------------
+# Copyright (c) 2026, Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+#-------------------------------------------------------------------------------
+
+# Generate the perfect hash table from thread names to NSIDs, which is looked
+# up by nsid_mgr_get_thread_nsid().
+#
+# The thread names are first hashed with 32-bit FNV-1a and spread into buckets.
+# Each bucket gets a displacement which maps all of its names into distinct
+# free slots of the table. A lookup then costs a single hash of the thread name
+# and a single string comparison, whatever the number of names.
+#
+# The hash functions must be kept in sync with tfm_nsid_map_table.c.
+
+set(NSID_MAP_FNV_BASIS   2166136261)
+set(NSID_MAP_FNV_PRIME   16777619)
+set(NSID_MAP_MAX_DISP    65535)
+
+# 32-bit FNV-1a hash of a string
+function(nsid_map_name_hash name out)
+    set(hash ${NSID_MAP_FNV_BASIS})
+
+    string(HEX "${name}" hex)
+    string(LENGTH "${hex}" len)
+    math(EXPR last "${len} - 2")
+
+    foreach(i RANGE 0 ${last} 2)
+        string(SUBSTRING "${hex}" ${i} 2 byte)
+        math(EXPR hash "((${hash} ^ 0x${byte}) * ${NSID_MAP_FNV_PRIME}) & 0xFFFFFFFF")
+    endforeach()
+
+    set(${out} ${hash} PARENT_SCOPE)
+endfunction()
+
+# Slot of a name hash with the displacement of its bucket
+function(nsid_map_slot hash disp nr_slots out)
+    math(EXPR h "((${hash} ^ ${disp}) * ${NSID_MAP_FNV_PRIME}) & 0xFFFFFFFF")
+    math(EXPR h "${h} ^ (${h} >> 15)")
+    math(EXPR h "(${h} * ${NSID_MAP_FNV_PRIME}) & 0xFFFFFFFF")
+    math(EXPR h "(${h} ^ (${h} >> 13)) % ${nr_slots}")
+
+    set(${out} ${h} PARENT_SCOPE)
+endfunction()
+
+# Try to place all the names into nr_slots slots. Set out to FALSE on failure.
+function(nsid_map_place nr_names nr_buckets nr_slots out)
+    math(EXPR last_name "${nr_names} - 1")
+    math(EXPR last_bucket "${nr_buckets} - 1")
+    math(EXPR last_slot "${nr_slots} - 1")
+
+    foreach(b RANGE 0 ${last_bucket})
+        set(bucket_${b} "")
+        set(disp_${b} 0)
+    endforeach()
+
+    set(max_size 0)
+    foreach(i RANGE 0 ${last_name})
+        math(EXPR b "${hash_${i}} % ${nr_buckets}")
+        list(APPEND bucket_${b} ${i})
+        list(LENGTH bucket_${b} size)
+        if(size GREATER max_size)
+            set(max_size ${size})
+        endif()
+    endforeach()
+
+    foreach(s RANGE 0 ${last_slot})
+        set(slot_${s} -1)
+    endforeach()
+
+    # The largest buckets are placed first, while most of the slots are free
+    foreach(size RANGE ${max_size} 1 -1)
+        foreach(b RANGE 0 ${last_bucket})
+            list(LENGTH bucket_${b} bucket_size)
+            if(NOT bucket_size EQUAL size)
+                continue()
+            endif()
+
+            foreach(disp RANGE 0 ${NSID_MAP_MAX_DISP})
+                set(taken "")
+                foreach(i IN LISTS bucket_${b})
+                    nsid_map_slot(${hash_${i}} ${disp} ${nr_slots} s)
+                    if(NOT slot_${s} EQUAL -1 OR s IN_LIST taken)
+                        break()
+                    endif()
+                    list(APPEND taken ${s})
+                endforeach()
+
+                list(LENGTH taken nr_taken)
+                if(nr_taken EQUAL size)
+                    set(disp_${b} ${disp})
+                    break()
+                endif()
+            endforeach()
+
+            if(NOT nr_taken EQUAL size)
+                set(${out} FALSE PARENT_SCOPE)
+                return()
+            endif()
+
+            foreach(i s IN ZIP_LISTS bucket_${b} taken)
+                set(slot_${s} ${i})
+            endforeach()
+        endforeach()
+    endforeach()
+
+    set(disps "")
+    foreach(b RANGE 0 ${last_bucket})
+        string(APPEND disps "    ${disp_${b}},\n")
+    endforeach()
+
+    set(slots "")
+    foreach(s RANGE 0 ${last_slot})
+        if(slot_${s} EQUAL -1)
+            string(APPEND slots "    {NULL, TFM_DEFAULT_NSID},\n")
+        else()
+            set(i ${slot_${s}})
+            string(APPEND slots "    {\"${name_${i}}\", ${nsid_${i}}},\n")
+        endif()
+    endforeach()
+
+    set(NSID_MAP_DISPS ${disps} PARENT_SCOPE)
+    set(NSID_MAP_SLOTS ${slots} PARENT_SCOPE)
+    set(${out} TRUE PARENT_SCOPE)
+endfunction()
+
+# Generate out_file from the list of "<thread name>:<NSID>" pairs
+function(tfm_nsid_map_generate out_file)
+    set(nr_names 0)
+    set(names "")
+
+    foreach(pair IN LISTS ARGN)
+        if(NOT pair MATCHES "^([^\"\\\\]+):(-[0-9]+)$")
+            message(FATAL_ERROR "Invalid thread name to NSID pair '${pair}'")
+        endif()
+
+        set(name ${CMAKE_MATCH_1})
+        set(nsid ${CMAKE_MATCH_2})
+
+        if(name IN_LIST names)
+            message(FATAL_ERROR "Thread name '${name}' is assigned more than one NSID")
+        endif()
+        # -1 is reserved for NSID as a default value
+        if(nsid EQUAL -1)
+            message(FATAL_ERROR "NSID -1 of thread '${name}' is reserved as the default NSID")
+        endif()
+
+        list(APPEND names "${name}")
+        set(name_${nr_names} "${name}")
+        set(nsid_${nr_names} ${nsid})
+        nsid_map_name_hash("${name}" hash_${nr_names})
+        math(EXPR nr_names "${nr_names} + 1")
+    endforeach()
+
+    if(nr_names EQUAL 0)
+        set(nr_buckets 1)
+        set(nr_slots 1)
+        set(NSID_MAP_DISPS "    0,\n")
+        set(NSID_MAP_SLOTS "    {NULL, TFM_DEFAULT_NSID},\n")
+    else()
+        # About 3 names per bucket and a table 80% full. Grow it on failure.
+        math(EXPR nr_buckets "(${nr_names} + 2) / 3")
+        math(EXPR nr_slots "${nr_names} + (${nr_names} + 3) / 4")
+
+        nsid_map_place(${nr_names} ${nr_buckets} ${nr_slots} placed)
+        while(NOT placed)
+            math(EXPR nr_slots "${nr_slots} + (${nr_slots} + 3) / 4")
+            nsid_map_place(${nr_names} ${nr_buckets} ${nr_slots} placed)
+        endwhile()
+    endif()
+
+    set(NSID_MAP_NR_BUCKETS ${nr_buckets})
+    set(NSID_MAP_NR_SLOTS ${nr_slots})
+
+    configure_file(${CMAKE_CURRENT_FUNCTION_LIST_DIR}/tfm_nsid_map_hash.h.in
+                   ${out_file}
+                   @ONLY)
+endfunction()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -10,6 +10,10 @@
  * NSIDs of specific threads are statically pre-assigned.
  * Other threads use default NSID value -1.
  *
+ * The thread names and their NSIDs are listed in TFM_NS_NSID_MAP. A perfect
+ * hash table of them is generated at build time, so that the NSID is found
+ * with a single string comparison whatever the number of threads.
+ *
  * Developers can design the assignment according to RTOS and usage scenarios.
  * The assignment can be static or dynamic.
  */
@@ -24,20 +28,40 @@ struct thread_test_nsid_pair {
     int32_t     nsid;       /* NSID */
 };
 
-/* -1 is reserved for NSID as a default value */
-static const struct thread_test_nsid_pair test_ns_nsid_table[] =
+/*
+ * Generated from TFM_NS_NSID_MAP.
+ * -1 is reserved for NSID as a default value.
+ */
+#include "tfm_nsid_map_hash.h"
+
+/* The hash functions must be kept in sync with tfm_nsid_map_hash.cmake */
+#define NSID_MAP_FNV_BASIS    2166136261U
+#define NSID_MAP_FNV_PRIME    16777619U
+
+/* 32-bit FNV-1a hash of the thread name */
+static uint32_t nsid_map_name_hash(const char *t_name)
 {
-    {"Thread_A", -2},
-    {"Thread_B", -3},
-    {"Thread_C", -4},
-    {"Thread_D", -5},
-    {"seq_task", -6},
-    {"mid_task", -7},
-    {"pri_task", -8},
-#ifdef PSA_API_TEST_NS
-    {"psa_api_test", -9}
-#endif
-};
+    uint32_t hash = NSID_MAP_FNV_BASIS;
+
+    while (*t_name != '\0') {
+        hash = (hash ^ (uint8_t)*t_name++) * NSID_MAP_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/* The only slot where the thread name can be */
+static uint32_t nsid_map_slot(uint32_t hash)
+{
+    uint32_t h = hash ^ nsid_map_disps[hash % NSID_MAP_NR_BUCKETS];
+
+    h *= NSID_MAP_FNV_PRIME;
+    h ^= h >> 15;
+    h *= NSID_MAP_FNV_PRIME;
+    h ^= h >> 13;
+
+    return h % NSID_MAP_NR_SLOTS;
+}
 
 /*
  * Workaround: strcmp func in string.h would come into a runtime error
@@ -61,16 +85,15 @@ static int str_cmp(const char* str_a, const char* str_b)
 
 int32_t nsid_mgr_get_thread_nsid(const char* t_name)
 {
-    uint32_t i;
+    const struct thread_test_nsid_pair *pair;
 
     if (t_name == NULL) {
         return TFM_DEFAULT_NSID;
     }
 
-    for (i = 0; i < ARRAY_SIZE(test_ns_nsid_table); i++) {
-        if (str_cmp(test_ns_nsid_table[i].t_name, t_name) == 0) {
-            return test_ns_nsid_table[i].nsid;
-        }
+    pair = &nsid_map_slots[nsid_map_slot(nsid_map_name_hash(t_name))];
+    if ((pair->t_name != NULL) && (str_cmp(pair->t_name, t_name) == 0)) {
+        return pair->nsid;
     }
 
     /* Thread name not specified in the table, return default NSID */
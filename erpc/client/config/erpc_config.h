@@ -2,7 +2,7 @@
  * Copyright (c) 2016, Freescale Semiconductor, Inc.
  * Copyright 2016-2020 NXP
  * Copyright 2020-2021 ACRIOS Systems s.r.o.
- * Copyright (c) 2023-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited. All rights reserved.
  * All rights reserved.
  *
  *
@@ -119,6 +119,19 @@
 //! Default value is set to 2.
 //#define ERPC_DEFAULT_BUFFERS_COUNT (2U)
 
+//! @def ERPC_PSA_CALL_ASYNC_MAX_PENDING
+//!
+//! Uncomment to change the number of psa_call which can be submitted and not completed at the same time (see
+//! erpc_client_async.h). The default value is 8.
+//#define ERPC_PSA_CALL_ASYNC_MAX_PENDING (8U)
+
+//! @def ERPC_PSA_CALL_ASYNC_WINDOW
+//!
+//! Uncomment to change the bytes of requests and replies of the submitted psa_call which can be in flight at the same
+//! time. It must not be larger than what the link and the server can buffer, see ERPC_SERVER_RX_QUEUE_SIZE for the
+//! UART transport of the server. The default size is ERPC_DEFAULT_BUFFER_SIZE.
+//#define ERPC_PSA_CALL_ASYNC_WINDOW (3072U)
+
 //! @def ERPC_NOEXCEPT
 //!
 //! @brief Disable/enable noexcept support.
@@ -172,7 +185,8 @@
 //! detection of eRPC call freeze, ... Default set to ERPC_PRE_POST_ACTION_DISABLED.
 //!
 //! Uncomment for using pre post callback feature.
-//#define ERPC_PRE_POST_ACTION (ERPC_PRE_POST_ACTION_ENABLED)
+//! The test host serializes the calls of its threads with them.
+#define ERPC_PRE_POST_ACTION (ERPC_PRE_POST_ACTION_ENABLED)
 
 //! @def ERPC_PRE_POST_ACTION_DEFAULT
 //!
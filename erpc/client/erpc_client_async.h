@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Pipelined psa_call over eRPC.
+ *
+ * psa_call() waits for the reply of each request before it sends the next one,
+ * so the link is idle while the secure service runs. The calls below send the
+ * zero-copy psa_call requests without waiting for their replies. The server
+ * handles the queued requests one after the other, and the replies are matched
+ * to the submitted calls by the sequence numbers of their eRPC messages.
+ *
+ * At most ERPC_PSA_CALL_ASYNC_MAX_PENDING calls are in flight, with at most
+ * ERPC_PSA_CALL_ASYNC_WINDOW bytes of requests and replies between them. Both
+ * can be set in the eRPC config file. The first call reads the size of the
+ * receive queue of the server, which further bounds the window, so that no
+ * request is lost. The calls are not supported by a server without a queue,
+ * such as the UART server built without ERPC_SERVER_RX_QUEUE. When a new call
+ * does not fit, erpc_psa_call_submit() first waits for the oldest ones.
+ *
+ * The calls must be made from a single thread. All the submitted calls must
+ * be completed before any other PSA client API is called.
+ */
+
+#ifndef __ERPC_CLIENT_ASYNC_H__
+#define __ERPC_CLIENT_ASYNC_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "erpc_transport_setup.h"
+#include "psa/client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Set the transport the replies of the submitted calls are received
+ *        from. It is called by erpc_client_start().
+ *
+ * \param[in] transport         Transport of the eRPC client.
+ */
+void erpc_client_async_init(erpc_transport_t transport);
+
+/**
+ * \brief Send a psa_call request without waiting for its reply.
+ *
+ * \param[in]  handle           Same as psa_call().
+ * \param[in]  type             Same as psa_call().
+ * \param[in]  in_vec           Same as psa_call(). The input vectors are sent
+ *                              before the function returns.
+ * \param[in]  in_len           Same as psa_call().
+ * \param[in]  out_vec          Same as psa_call(). The array and the buffers
+ *                              must stay valid until the call is completed.
+ * \param[in]  out_len          Same as psa_call().
+ * \param[out] sequence         Sequence number of the call, to be passed to
+ *                              erpc_psa_call_complete().
+ *
+ * \retval PSA_SUCCESS                      The request is sent.
+ * \retval PSA_ERROR_PROGRAMMER_ERROR       Too many vectors.
+ * \retval PSA_ERROR_INSUFFICIENT_MEMORY    All the calls are waiting to be
+ *                                          completed.
+ * \retval PSA_ERROR_NOT_SUPPORTED          The server does not queue the
+ *                                          requests received while it is
+ *                                          busy. psa_call() must be used.
+ * \retval PSA_ERROR_COMMUNICATION_FAILURE  The request could not be sent.
+ */
+psa_status_t erpc_psa_call_submit(psa_handle_t handle, int32_t type,
+                                  const psa_invec *in_vec, size_t in_len,
+                                  psa_outvec *out_vec, size_t out_len,
+                                  uint32_t *sequence);
+
+/**
+ * \brief Wait for the reply of a submitted call.
+ *
+ * \details The replies of the other calls received in the meantime are
+ *          decoded into their own output vectors, to be returned by their
+ *          own erpc_psa_call_complete().
+ *
+ * \param[in] sequence          Sequence number of the call.
+ *
+ * \return The status returned by psa_call(). The lengths of the output
+ *         vectors are updated on PSA_SUCCESS.
+ *         PSA_ERROR_PROGRAMMER_ERROR if no such call was submitted.
+ *         PSA_ERROR_COMMUNICATION_FAILURE if the reply is not received.
+ */
+psa_status_t erpc_psa_call_complete(uint32_t sequence);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ERPC_CLIENT_ASYNC_H__ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -7,12 +7,17 @@
 
 #include "erpc_mbf_setup.h"
 #include "erpc_client_setup.h"
+#include "erpc_client_async.h"
 #include "erpc_client_start.h"
 
 void erpc_client_start(erpc_transport_t transport)
 {
     erpc_mbf_t message_buffer_factory;
 
-    message_buffer_factory = erpc_mbf_dynamic_init();
+    /* Message buffers are allocated once and reused by the requests */
+    message_buffer_factory = erpc_mbf_static_init();
     erpc_client_init(transport, message_buffer_factory);
+
+    /* The replies of the pipelined psa_call are received from it */
+    erpc_client_async_init(transport);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -8,7 +8,17 @@
 #include <stddef.h>
 #include "psa/client.h"
 #include "tfm_erpc.h"
+#include "tfm_erpc_zero_copy.h"
 
+#ifdef ERPC_PSA_CALL_ZERO_COPY
+psa_status_t psa_call(psa_handle_t handle, int32_t type,
+                      const psa_invec *in_vec, size_t in_len,
+                      psa_outvec *out_vec, size_t out_len)
+{
+    return erpc_psa_call_zero_copy(handle, type, in_vec, in_len,
+                                   out_vec, out_len);
+}
+#else
 psa_status_t psa_call(psa_handle_t handle, int32_t type,
                       const psa_invec *in_vec, size_t in_len,
                       psa_outvec *out_vec, size_t out_len)
@@ -45,3 +55,4 @@ psa_status_t psa_call(psa_handle_t handle, int32_t type,
 
     return status;
 }
+#endif
@@ -0,0 +1,495 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "erpc_basic_codec.h"
+#include "erpc_client_manager.h"
+#include "erpc_codec.h"
+#include "erpc_framed_transport.h"
+extern "C"
+{
+#include "erpc_client_async.h"
+#include "tfm_erpc_zero_copy.h"
+}
+
+using namespace erpc;
+
+extern ClientManager *g_client;
+
+/*
+ * The number of submitted calls and the bytes of their requests and replies
+ * which can be in flight. They can be set in the eRPC config file.
+ */
+#ifndef ERPC_PSA_CALL_ASYNC_MAX_PENDING
+#define ERPC_PSA_CALL_ASYNC_MAX_PENDING     (8U)
+#endif
+
+#ifndef ERPC_PSA_CALL_ASYNC_WINDOW
+#define ERPC_PSA_CALL_ASYNC_WINDOW          ERPC_DEFAULT_BUFFER_SIZE
+#endif
+
+/*
+ * The bytes of a reply besides the out-vector data: the frame header, the
+ * message header and sequence, the length of the out-vector list and the status
+ */
+#define REPLY_OVERHEAD      (sizeof(FramedTransport::Header) + \
+                             4 * sizeof(uint32_t))
+
+enum pending_call_state_t {
+    CALL_FREE = 0,
+    CALL_PENDING,                   /* Waiting for the reply */
+    CALL_DONE,                      /* Reply received, not completed yet */
+};
+
+struct pending_call_t {
+    enum pending_call_state_t state;
+    uint32_t sequence;
+    psa_outvec *out_vec;
+    size_t out_len;
+    size_t cost;                    /* Bytes of the request and the reply */
+    psa_status_t result;
+};
+
+static Transport *s_transport = NULL;
+static struct pending_call_t s_calls[ERPC_PSA_CALL_ASYNC_MAX_PENDING];
+static uint32_t s_nr_pending;
+static size_t s_window_used;
+
+/* The window of the calls, bounded by the receive queue of the server */
+static size_t s_window;
+static bool s_window_read = false;
+
+/* The replies of the submitted calls are decoded from a dedicated buffer */
+static uint8_t s_reply_data[ERPC_DEFAULT_BUFFER_SIZE];
+static BasicCodec s_reply_codec;
+
+/* Encode a request straight from the caller buffers */
+static void write_request(Codec *codec, uint32_t sequence,
+                          psa_handle_t handle, int32_t type,
+                          const psa_invec *in_vec, size_t in_len,
+                          const psa_outvec *out_vec, size_t out_len)
+{
+    size_t i;
+
+    codec->startWriteMessage(kInvocationMessage,
+                             kpsa_zero_copy_api_service_id,
+                             kpsa_zero_copy_api_psa_call_id,
+                             sequence);
+
+    codec->write(handle);
+    codec->write(type);
+
+    codec->startWriteList((uint32_t)in_len);
+    for (i = 0; i < in_len; i++) {
+        codec->writeBinary((uint32_t)in_vec[i].len,
+                           (const uint8_t *)in_vec[i].base);
+    }
+
+    /* Only the sizes of the out-vectors are sent */
+    codec->startWriteList((uint32_t)out_len);
+    for (i = 0; i < out_len; i++) {
+        codec->write((uint32_t)out_vec[i].len);
+    }
+}
+
+/* Decode the out-vectors of the reply straight into the caller buffers */
+static void read_out_vecs(Codec *codec, psa_outvec *out_vec, size_t out_len,
+                          size_t *out_vec_len)
+{
+    uint32_t nr_out_vecs, len, i;
+    uint8_t *data;
+
+    codec->startReadList(&nr_out_vecs);
+    if (nr_out_vecs != out_len) {
+        codec->updateStatus(kErpcStatus_Fail);
+        return;
+    }
+
+    for (i = 0;
+         (i < nr_out_vecs) && (codec->getStatus() == kErpcStatus_Success);
+         i++) {
+        codec->readBinary(&len, &data);
+        if (len > out_vec[i].len) {
+            codec->updateStatus(kErpcStatus_BufferOverrun);
+            return;
+        }
+
+        if (len > 0) {
+            memcpy(out_vec[i].base, data, len);
+        }
+        out_vec_len[i] = len;
+    }
+}
+
+psa_status_t erpc_psa_call_zero_copy(psa_handle_t handle, int32_t type,
+                                     const psa_invec *in_vec, size_t in_len,
+                                     psa_outvec *out_vec, size_t out_len)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    psa_status_t result = PSA_ERROR_COMMUNICATION_FAILURE;
+    size_t out_vec_len[PSA_MAX_IOVEC];
+    size_t i;
+
+    if (in_len + out_len > PSA_MAX_IOVEC) {
+        return PSA_ERROR_PROGRAMMER_ERROR;
+    }
+
+#if ERPC_PRE_POST_ACTION
+    pre_post_action_cb preCB = g_client->getPreCB();
+    if (preCB) {
+        preCB();
+    }
+#endif
+
+    RequestContext request = g_client->createRequest(false);
+    Codec *codec = request.getCodec();
+
+    if (codec == NULL) {
+        err = kErpcStatus_MemoryError;
+    } else {
+        write_request(codec, request.getSequence(), handle, type,
+                      in_vec, in_len, out_vec, out_len);
+
+        g_client->performRequest(request);
+
+        read_out_vecs(codec, out_vec, out_len, out_vec_len);
+
+        codec->read(&result);
+
+        err = codec->getStatus();
+    }
+
+    g_client->releaseRequest(request);
+
+    g_client->callErrorHandler(err, kpsa_zero_copy_api_psa_call_id);
+
+#if ERPC_PRE_POST_ACTION
+    pre_post_action_cb postCB = g_client->getPostCB();
+    if (postCB) {
+        postCB();
+    }
+#endif
+
+    if (err != kErpcStatus_Success) {
+        return PSA_ERROR_COMMUNICATION_FAILURE;
+    }
+
+    if (result != PSA_SUCCESS) {
+        return result;
+    }
+
+    /* Copy updated out length into PSA outvec */
+    for (i = 0; i < out_len; i++) {
+        out_vec[i].len = out_vec_len[i];
+    }
+
+    return result;
+}
+
+/*
+ * It is called by the pre action of the client calls, so it does not run the
+ * pre and post actions itself.
+ */
+psa_status_t erpc_client_set_nsid(int32_t nsid)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    psa_status_t result = PSA_ERROR_COMMUNICATION_FAILURE;
+
+    RequestContext request = g_client->createRequest(false);
+    Codec *codec = request.getCodec();
+
+    if (codec == NULL) {
+        err = kErpcStatus_MemoryError;
+    } else {
+        codec->startWriteMessage(kInvocationMessage,
+                                 kpsa_zero_copy_api_service_id,
+                                 kpsa_zero_copy_api_set_nsid_id,
+                                 request.getSequence());
+        codec->write(nsid);
+
+        g_client->performRequest(request);
+
+        codec->read(&result);
+
+        err = codec->getStatus();
+    }
+
+    g_client->releaseRequest(request);
+
+    g_client->callErrorHandler(err, kpsa_zero_copy_api_set_nsid_id);
+
+    if (err != kErpcStatus_Success) {
+        return PSA_ERROR_COMMUNICATION_FAILURE;
+    }
+
+    return result;
+}
+
+/*
+ * Read the size of the receive queue of the server. Without a queue, the
+ * requests sent while the server is busy are lost.
+ */
+static psa_status_t read_server_window(void)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    uint32_t rx_window = 0;
+
+    RequestContext request = g_client->createRequest(false);
+    Codec *codec = request.getCodec();
+
+    if (codec == NULL) {
+        err = kErpcStatus_MemoryError;
+    } else {
+        codec->startWriteMessage(kInvocationMessage,
+                                 kpsa_zero_copy_api_service_id,
+                                 kpsa_zero_copy_api_get_rx_window_id,
+                                 request.getSequence());
+
+        g_client->performRequest(request);
+
+        codec->read(&rx_window);
+
+        err = codec->getStatus();
+    }
+
+    g_client->releaseRequest(request);
+
+    g_client->callErrorHandler(err, kpsa_zero_copy_api_get_rx_window_id);
+
+    if (err != kErpcStatus_Success) {
+        return PSA_ERROR_COMMUNICATION_FAILURE;
+    }
+
+    s_window = (rx_window < ERPC_PSA_CALL_ASYNC_WINDOW) ?
+               rx_window : ERPC_PSA_CALL_ASYNC_WINDOW;
+    s_window_read = true;
+
+    return PSA_SUCCESS;
+}
+
+static struct pending_call_t *find_call(uint32_t sequence)
+{
+    uint32_t i;
+
+    for (i = 0; i < ERPC_PSA_CALL_ASYNC_MAX_PENDING; i++) {
+        if ((s_calls[i].state != CALL_FREE) &&
+            (s_calls[i].sequence == sequence)) {
+            return &s_calls[i];
+        }
+    }
+
+    return NULL;
+}
+
+static struct pending_call_t *find_free_call(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < ERPC_PSA_CALL_ASYNC_MAX_PENDING; i++) {
+        if (s_calls[i].state == CALL_FREE) {
+            return &s_calls[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * The replies cannot be matched to the calls any more once one is lost. All
+ * the calls in flight fail.
+ */
+static void fail_pending_calls(erpc_status_t err)
+{
+    uint32_t i;
+
+    for (i = 0; i < ERPC_PSA_CALL_ASYNC_MAX_PENDING; i++) {
+        if (s_calls[i].state == CALL_PENDING) {
+            s_calls[i].state = CALL_DONE;
+            s_calls[i].result = PSA_ERROR_COMMUNICATION_FAILURE;
+        }
+    }
+
+    s_nr_pending = 0;
+    s_window_used = 0;
+
+    g_client->callErrorHandler(err, kpsa_zero_copy_api_psa_call_id);
+}
+
+/* Receive the next reply, and decode it into the call of the same sequence */
+static erpc_status_t receive_reply(void)
+{
+    MessageBuffer buffer(s_reply_data, sizeof(s_reply_data));
+    Codec *codec = &s_reply_codec;
+    struct pending_call_t *call = NULL;
+    size_t out_vec_len[PSA_MAX_IOVEC];
+    message_type_t msg_type;
+    uint32_t service, method, sequence;
+    erpc_status_t err;
+    size_t i;
+
+    err = s_transport->receive(&buffer);
+    if (err != kErpcStatus_Success) {
+        return err;
+    }
+
+    codec->setBuffer(buffer);
+    codec->startReadMessage(&msg_type, &service, &method, &sequence);
+    if (codec->getStatus() == kErpcStatus_Success) {
+        call = find_call(sequence);
+        if ((msg_type != kReplyMessage) ||
+            (service != kpsa_zero_copy_api_service_id) ||
+            (method != kpsa_zero_copy_api_psa_call_id) ||
+            (call == NULL) || (call->state != CALL_PENDING)) {
+            codec->updateStatus(kErpcStatus_ExpectedReply);
+        }
+    }
+
+    if (codec->getStatus() == kErpcStatus_Success) {
+        read_out_vecs(codec, call->out_vec, call->out_len, out_vec_len);
+        codec->read(&call->result);
+    }
+
+    err = codec->getStatus();
+    if (err != kErpcStatus_Success) {
+        return err;
+    }
+
+    if (call->result == PSA_SUCCESS) {
+        for (i = 0; i < call->out_len; i++) {
+            call->out_vec[i].len = out_vec_len[i];
+        }
+    }
+
+    call->state = CALL_DONE;
+    s_nr_pending--;
+    s_window_used -= call->cost;
+
+    return kErpcStatus_Success;
+}
+
+void erpc_client_async_init(erpc_transport_t transport)
+{
+    s_transport = reinterpret_cast<Transport *>(transport);
+}
+
+psa_status_t erpc_psa_call_submit(psa_handle_t handle, int32_t type,
+                                  const psa_invec *in_vec, size_t in_len,
+                                  psa_outvec *out_vec, size_t out_len,
+                                  uint32_t *sequence)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    struct pending_call_t *call = NULL;
+    size_t cost, i;
+
+    if ((in_len + out_len > PSA_MAX_IOVEC) || (sequence == NULL)) {
+        return PSA_ERROR_PROGRAMMER_ERROR;
+    }
+
+    if (s_transport == NULL) {
+        return PSA_ERROR_COMMUNICATION_FAILURE;
+    }
+
+    /* No call is in flight until the window is read */
+    if (!s_window_read && (read_server_window() != PSA_SUCCESS)) {
+        return PSA_ERROR_COMMUNICATION_FAILURE;
+    }
+
+    if (s_window == 0) {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+
+    RequestContext request = g_client->createRequest(true);
+    Codec *codec = request.getCodec();
+
+    if (codec == NULL) {
+        err = kErpcStatus_MemoryError;
+    } else {
+        write_request(codec, request.getSequence(), handle, type,
+                      in_vec, in_len, out_vec, out_len);
+        err = codec->getStatus();
+    }
+
+    if (err == kErpcStatus_Success) {
+        cost = sizeof(FramedTransport::Header) +
+               codec->getBuffer()->getUsed() +
+               REPLY_OVERHEAD + out_len * sizeof(uint32_t);
+        for (i = 0; i < out_len; i++) {
+            cost += out_vec[i].len;
+        }
+
+        /*
+         * Wait for the oldest calls until the new one fits. A call larger
+         * than the window is sent alone.
+         */
+        call = find_free_call();
+        while ((s_nr_pending > 0) &&
+               ((call == NULL) ||
+                (s_window_used + cost > s_window))) {
+            err = receive_reply();
+            if (err != kErpcStatus_Success) {
+                fail_pending_calls(err);
+                break;
+            }
+            call = find_free_call();
+        }
+    }
+
+    if ((err == kErpcStatus_Success) && (call != NULL)) {
+        /* Only sent, the reply is received by erpc_psa_call_complete() */
+        g_client->performRequest(request);
+        err = codec->getStatus();
+        if (err != kErpcStatus_Success) {
+            g_client->callErrorHandler(err, kpsa_zero_copy_api_psa_call_id);
+        }
+    }
+
+    if (codec != NULL) {
+        g_client->releaseRequest(request);
+    }
+
+    if (err != kErpcStatus_Success) {
+        return PSA_ERROR_COMMUNICATION_FAILURE;
+    }
+
+    /* All the calls are completed but not collected */
+    if (call == NULL) {
+        return PSA_ERROR_INSUFFICIENT_MEMORY;
+    }
+
+    call->state = CALL_PENDING;
+    call->sequence = request.getSequence();
+    call->out_vec = out_vec;
+    call->out_len = out_len;
+    call->cost = cost;
+    s_nr_pending++;
+    s_window_used += cost;
+
+    *sequence = call->sequence;
+
+    return PSA_SUCCESS;
+}
+
+psa_status_t erpc_psa_call_complete(uint32_t sequence)
+{
+    struct pending_call_t *call = find_call(sequence);
+    erpc_status_t err;
+
+    if (call == NULL) {
+        return PSA_ERROR_PROGRAMMER_ERROR;
+    }
+
+    while (call->state == CALL_PENDING) {
+        err = receive_reply();
+        if (err != kErpcStatus_Success) {
+            fail_pending_calls(err);
+        }
+    }
+
+    call->state = CALL_FREE;
+
+    return call->result;
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Test of the pipelined psa_call against the host server, run with ctest. The
+ * server binary is given as argument and started on a shared memory object of
+ * its own. Its stub psa_call echoes the in-vectors into the out-vectors, so
+ * that each reply is checked against the payload of its own call.
+ */
+
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "erpc_client_async.h"
+#include "erpc_client_start.h"
+#include "erpc_shm_transport.h"
+#include "psa/client.h"
+
+/* Any handle is accepted by the stub psa_call */
+#define TEST_HANDLE                 ((psa_handle_t)0x40000001)
+/* More calls than the window holds, as many as can be pending */
+#define TEST_NR_CALLS               8
+#define TEST_PAYLOAD_SIZE           256
+/* Wait for the server to create the shared memory, in us */
+#define TEST_START_POLL_US          10000U
+#define TEST_START_RETRIES          500
+
+#define TEST_CHECK(cond, msg)                                       \
+    do {                                                            \
+        if (!(cond)) {                                              \
+            printf("FAILED: %s\r\n", (msg));                        \
+            return false;                                           \
+        }                                                           \
+    } while (0)
+
+static uint8_t in_bufs[TEST_NR_CALLS][TEST_PAYLOAD_SIZE];
+static uint8_t out_bufs[TEST_NR_CALLS][TEST_PAYLOAD_SIZE];
+static psa_invec in_vecs[TEST_NR_CALLS];
+static psa_outvec out_vecs[TEST_NR_CALLS];
+static uint32_t sequences[TEST_NR_CALLS];
+
+/* Each call has its own payload, and a different length */
+static void prepare_call(uint32_t i)
+{
+    uint32_t j;
+
+    for (j = 0; j < TEST_PAYLOAD_SIZE; j++) {
+        in_bufs[i][j] = (uint8_t)(i * 31 + j);
+    }
+    memset(out_bufs[i], 0, TEST_PAYLOAD_SIZE);
+
+    in_vecs[i].base = in_bufs[i];
+    in_vecs[i].len = TEST_PAYLOAD_SIZE - i;
+    out_vecs[i].base = out_bufs[i];
+    out_vecs[i].len = TEST_PAYLOAD_SIZE;
+}
+
+static bool check_call(uint32_t i)
+{
+    TEST_CHECK(out_vecs[i].len == in_vecs[i].len, "Out-vector length");
+    TEST_CHECK(memcmp(out_bufs[i], in_bufs[i], in_vecs[i].len) == 0,
+               "Out-vector matches the call");
+
+    return true;
+}
+
+static bool test_call(void)
+{
+    prepare_call(0);
+
+    TEST_CHECK(psa_call(TEST_HANDLE, PSA_IPC_CALL, &in_vecs[0], 1,
+                        &out_vecs[0], 1) == PSA_SUCCESS, "Blocking call");
+
+    return check_call(0);
+}
+
+static bool test_pipelined_calls(void)
+{
+    psa_invec extra_in_vec = {in_bufs[0], 1};
+    psa_outvec extra_out_vec = {out_bufs[0], 1};
+    uint32_t extra_sequence, i;
+
+    for (i = 0; i < TEST_NR_CALLS; i++) {
+        prepare_call(i);
+        TEST_CHECK(erpc_psa_call_submit(TEST_HANDLE, PSA_IPC_CALL,
+                                        &in_vecs[i], 1, &out_vecs[i], 1,
+                                        &sequences[i]) == PSA_SUCCESS,
+                   "Call submitted");
+    }
+
+    /* All the calls are received, but none is completed */
+    TEST_CHECK(erpc_psa_call_submit(TEST_HANDLE, PSA_IPC_CALL,
+                                    &extra_in_vec, 1, &extra_out_vec, 1,
+                                    &extra_sequence) ==
+               PSA_ERROR_INSUFFICIENT_MEMORY, "Call rejected when all pending");
+
+    for (i = 0; i < TEST_NR_CALLS; i++) {
+        TEST_CHECK(erpc_psa_call_complete(sequences[i]) == PSA_SUCCESS,
+                   "Call completed");
+        TEST_CHECK(check_call(i), "Reply of the call");
+    }
+
+    TEST_CHECK(erpc_psa_call_complete(sequences[0]) ==
+               PSA_ERROR_PROGRAMMER_ERROR, "Call completed twice");
+
+    /* The replies are matched to the calls in any order of completion */
+    for (i = 0; i < TEST_NR_CALLS; i++) {
+        prepare_call(i);
+        TEST_CHECK(erpc_psa_call_submit(TEST_HANDLE, PSA_IPC_CALL,
+                                        &in_vecs[i], 1, &out_vecs[i], 1,
+                                        &sequences[i]) == PSA_SUCCESS,
+                   "Call submitted");
+    }
+
+    for (i = TEST_NR_CALLS; i > 0; i--) {
+        TEST_CHECK(erpc_psa_call_complete(sequences[i - 1]) == PSA_SUCCESS,
+                   "Call completed");
+        TEST_CHECK(check_call(i - 1), "Reply of the call");
+    }
+
+    /* The link is still in sync */
+    return test_call();
+}
+
+static bool run_tests(const char *name, pid_t server)
+{
+    erpc_transport_t transport = NULL;
+    int i;
+
+    for (i = 0; (i < TEST_START_RETRIES) && (transport == NULL); i++) {
+        TEST_CHECK(waitpid(server, NULL, WNOHANG) == 0, "Server running");
+        usleep(TEST_START_POLL_US);
+        transport = erpc_transport_shm_init(name, false);
+    }
+    TEST_CHECK(transport, "Transport initialization");
+
+    erpc_client_start(transport);
+
+    return test_call() && test_pipelined_calls();
+}
+
+int main(int argc, char *argv[])
+{
+    char name[32];
+    pid_t server;
+    bool passed;
+
+    if (argc != 2) {
+        printf("Usage: %s SERVER\r\n", argv[0]);
+        return 1;
+    }
+
+    /* The tests run in parallel do not share the server */
+    snprintf(name, sizeof(name), "/tfm_erpc_async_%d", (int)getpid());
+
+    server = fork();
+    if (server < 0) {
+        printf("FAILED: Server start\r\n");
+        return 1;
+    } else if (server == 0) {
+        execl(argv[1], argv[1], name, (char *)NULL);
+        _exit(1);
+    }
+
+    passed = run_tests(name, server);
+
+    kill(server, SIGTERM);
+    (void)waitpid(server, NULL, 0);
+    (void)shm_unlink(name);
+
+    if (!passed) {
+        return 1;
+    }
+
+    printf("PASSED\r\n");
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include "erpc_server_start.h"
+#include "erpc_shm_transport.h"
+#include "tfm_erpc_zero_copy.h"
+
+/* The client pipelines its calls up to the size of the ring buffers */
+uint32_t erpc_server_get_rx_window(void)
+{
+    return ERPC_SHM_RING_SIZE;
+}
+
+int main(int argc, char *argv[])
+{
+    erpc_transport_t transport;
+    const char *name = ERPC_SHM_DEFAULT_NAME;
+
+    if (argc > 2) {
+        printf("Usage: %s [SHM_NAME]\r\n", argv[0]);
+        return 1;
+    } else if (argc == 2) {
+        name = argv[1];
+    }
+
+    transport = erpc_transport_shm_init(name, true);
+    if (!transport) {
+        printf("eRPC transport initialization failed!\r\n");
+        return 1;
+    }
+
+    printf("eRPC server is listening on shared memory %s\r\n", name);
+
+    erpc_server_start(transport);
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Stub PSA client APIs for the host server. No secure service is called. The
+ * in-vectors of psa_call are echoed into the out-vectors, so that the whole
+ * eRPC round trip is exercised with real payloads.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "psa/client.h"
+
+/* The handle of all the stub connections */
+#define STUB_CONNECTION_HANDLE      ((psa_handle_t)0x40000001)
+
+uint32_t psa_framework_version(void)
+{
+    return PSA_FRAMEWORK_VERSION;
+}
+
+uint32_t psa_version(uint32_t sid)
+{
+    (void)sid;
+
+    return 1;
+}
+
+psa_handle_t psa_connect(uint32_t sid, uint32_t version)
+{
+    (void)sid;
+    (void)version;
+
+    return STUB_CONNECTION_HANDLE;
+}
+
+void psa_close(psa_handle_t handle)
+{
+    (void)handle;
+}
+
+psa_status_t psa_call(psa_handle_t handle, int32_t type,
+                      const psa_invec *in_vec, size_t in_len,
+                      psa_outvec *out_vec, size_t out_len)
+{
+    size_t in_idx = 0, in_offset = 0, out_idx, len;
+
+    (void)handle;
+    (void)type;
+
+    /* Fill the out-vectors one after the other with the in-vectors */
+    for (out_idx = 0; out_idx < out_len; out_idx++) {
+        len = 0;
+
+        while ((in_idx < in_len) && (len < out_vec[out_idx].len)) {
+            size_t chunk = in_vec[in_idx].len - in_offset;
+
+            if (chunk > out_vec[out_idx].len - len) {
+                chunk = out_vec[out_idx].len - len;
+            }
+
+            memcpy((uint8_t *)out_vec[out_idx].base + len,
+                   (const uint8_t *)in_vec[in_idx].base + in_offset, chunk);
+            len += chunk;
+            in_offset += chunk;
+
+            if (in_offset == in_vec[in_idx].len) {
+                in_idx++;
+                in_offset = 0;
+            }
+        }
+
+        out_vec[out_idx].len = len;
+    }
+
+    return PSA_SUCCESS;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -8,6 +8,14 @@
 #include "tfm_log.h"
 #include "erpc_server_start.h"
 #include "config_erpc_target.h"
+#include "tfm_erpc_zero_copy.h"
+#ifdef ERPC_SERVER_RX_QUEUE
+#include "erpc_uart_queued_transport.h"
+#endif
+#ifdef TFM_NS_MANAGE_NSID
+#include "cmsis_os2.h"
+#include "tfm_nsid_manager.h"
+#endif
 
 #include "Driver_USART.h"
 #ifdef ERPC_UART
@@ -16,6 +24,41 @@ extern ARM_DRIVER_USART ERPC_UART;
 #error "ERPC_UART is not provided!"
 #endif
 
+#ifdef TFM_NS_MANAGE_NSID
+/*
+ * The server thread makes the PSA client calls of all the host threads. It
+ * switches to the NSID of each host thread, so that SPE sees distinct clients.
+ */
+psa_status_t erpc_server_set_nsid(int32_t nsid)
+{
+    int32_t lock;
+    uint8_t err;
+
+    if (nsid >= TFM_INVALID_NSID_MIN) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* The secure context must not be switched meanwhile */
+    lock = osKernelLock();
+    err = nsid_mgr_switch_nsid(nsid);
+    (void)osKernelRestoreLock(lock);
+
+    if (err != NSID_MGR_ERR_SUCCESS) {
+        return PSA_ERROR_GENERIC_ERROR;
+    }
+
+    return PSA_SUCCESS;
+}
+#endif
+
+#ifdef ERPC_SERVER_RX_QUEUE
+/* The client pipelines its calls up to the size of the receive queue */
+uint32_t erpc_server_get_rx_window(void)
+{
+    return ERPC_SERVER_RX_QUEUE_SIZE;
+}
+#endif
+
 __attribute__((noreturn))
 void test_app(void *argument)
 {
@@ -23,7 +66,11 @@ void test_app(void *argument)
 
     erpc_transport_t transport;
 
+#ifdef ERPC_SERVER_RX_QUEUE
+    transport = erpc_transport_uart_queued_init((void *)&ERPC_UART);
+#else
     transport = erpc_transport_cmsis_uart_init((void *)&ERPC_UART);
+#endif
     if (!transport) {
         LOG_MSG("eRPC transport init failed!\r\n");
     }
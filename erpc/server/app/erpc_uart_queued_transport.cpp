@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Driver_USART.h"
+#include "erpc_framed_transport.h"
+#include "erpc_uart_queued_transport.h"
+
+using namespace erpc;
+
+/* One byte is left unused to tell a full queue from an empty one */
+#define RX_QUEUE_LEN                (ERPC_SERVER_RX_QUEUE_SIZE + 1)
+
+class UartQueuedTransport : public FramedTransport
+{
+public:
+    erpc_status_t init(ARM_DRIVER_USART *uartDrv);
+
+protected:
+    virtual erpc_status_t underlyingSend(const uint8_t *data, uint32_t size);
+    virtual erpc_status_t underlyingReceive(uint8_t *data, uint32_t size);
+};
+
+static UartQueuedTransport s_transport;
+static ARM_DRIVER_USART *s_uart_drv = NULL;
+
+/*
+ * The head is only moved by the UART callback, and the tail by the server.
+ * The queue is not received into while it is full.
+ */
+static uint8_t s_rx_queue[RX_QUEUE_LEN];
+static volatile uint32_t s_rx_head;
+static volatile uint32_t s_rx_tail;
+static volatile bool s_rx_armed;
+static volatile bool s_tx_completed;
+
+/* Receive the next byte at the head of the queue, if there is room for it */
+static void rx_arm(void)
+{
+    if ((s_rx_head + 1) % RX_QUEUE_LEN == s_rx_tail) {
+        s_rx_armed = false;
+        return;
+    }
+
+    s_rx_armed = true;
+    if (s_uart_drv->Receive(&s_rx_queue[s_rx_head], 1) != ARM_DRIVER_OK) {
+        s_rx_armed = false;
+    }
+}
+
+static void uart_event_cb(uint32_t event)
+{
+    if (event & ARM_USART_EVENT_SEND_COMPLETE) {
+        s_tx_completed = true;
+    }
+
+    if (event & ARM_USART_EVENT_RECEIVE_COMPLETE) {
+        s_rx_head = (s_rx_head + 1) % RX_QUEUE_LEN;
+        rx_arm();
+    }
+}
+
+erpc_status_t UartQueuedTransport::init(ARM_DRIVER_USART *uartDrv)
+{
+    s_uart_drv = uartDrv;
+
+    if ((s_uart_drv->Initialize(uart_event_cb) != ARM_DRIVER_OK) ||
+        (s_uart_drv->PowerControl(ARM_POWER_FULL) != ARM_DRIVER_OK) ||
+        (s_uart_drv->Control(ARM_USART_CONTROL_TX, 1) != ARM_DRIVER_OK) ||
+        (s_uart_drv->Control(ARM_USART_CONTROL_RX, 1) != ARM_DRIVER_OK)) {
+        return kErpcStatus_InitFailed;
+    }
+
+    s_rx_head = 0;
+    s_rx_tail = 0;
+    rx_arm();
+
+    return s_rx_armed ? kErpcStatus_Success : kErpcStatus_InitFailed;
+}
+
+erpc_status_t UartQueuedTransport::underlyingSend(const uint8_t *data,
+                                                  uint32_t size)
+{
+    s_tx_completed = false;
+
+    if (s_uart_drv->Send(data, size) != ARM_DRIVER_OK) {
+        return kErpcStatus_SendFailed;
+    }
+
+    while (!s_tx_completed) {
+    }
+
+    return kErpcStatus_Success;
+}
+
+erpc_status_t UartQueuedTransport::underlyingReceive(uint8_t *data,
+                                                     uint32_t size)
+{
+    while (size > 0) {
+        while (s_rx_tail == s_rx_head) {
+        }
+
+        *data++ = s_rx_queue[s_rx_tail];
+        s_rx_tail = (s_rx_tail + 1) % RX_QUEUE_LEN;
+        size--;
+
+        /* The callback stopped receiving when the queue was full */
+        if (!s_rx_armed) {
+            rx_arm();
+        }
+    }
+
+    return kErpcStatus_Success;
+}
+
+erpc_transport_t erpc_transport_uart_queued_init(void *uart_drv)
+{
+    if ((uart_drv == NULL) ||
+        (s_transport.init((ARM_DRIVER_USART *)uart_drv) !=
+         kErpcStatus_Success)) {
+        return NULL;
+    }
+
+    return reinterpret_cast<erpc_transport_t>(&s_transport);
+}
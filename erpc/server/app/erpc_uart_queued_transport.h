@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __ERPC_UART_QUEUED_TRANSPORT_H__
+#define __ERPC_UART_QUEUED_TRANSPORT_H__
+
+#include "erpc_config_internal.h"
+#include "erpc_transport_setup.h"
+
+/*
+ * Size of the receive queue. It can be set in the eRPC config file. It is
+ * reported to the client, which does not pipeline more bytes of requests and
+ * replies.
+ */
+#ifndef ERPC_SERVER_RX_QUEUE_SIZE
+#define ERPC_SERVER_RX_QUEUE_SIZE   ERPC_DEFAULT_BUFFER_SIZE
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Initialize a CMSIS UART transport which keeps receiving while the
+ *        server handles a request.
+ *
+ * \details The received bytes are queued by the UART event callback, so that
+ *          a client can send the next requests before the replies of the
+ *          previous ones. The queue holds ERPC_SERVER_RX_QUEUE_SIZE bytes.
+ *          The CMSIS driver must be interrupt-driven: Receive() must return
+ *          before the data are received and report the completion from the
+ *          interrupt handler.
+ *
+ * \param[in] uart_drv          CMSIS USART driver.
+ *
+ * \return The transport, or NULL in case of error.
+ */
+erpc_transport_t erpc_transport_uart_queued_init(void *uart_drv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ERPC_UART_QUEUED_TRANSPORT_H__ */
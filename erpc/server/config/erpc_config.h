@@ -2,7 +2,7 @@
  * Copyright (c) 2016, Freescale Semiconductor, Inc.
  * Copyright 2016-2020 NXP
  * Copyright 2020-2021 ACRIOS Systems s.r.o.
- * Copyright (c) 2023-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited. All rights reserved.
  * All rights reserved.
  *
  *
@@ -71,7 +71,7 @@
 //! supported by compiler. Uncomment comment bellow to use static allocation policy. In case of static implementation
 //! user need consider another values to set (ERPC_CODEC_COUNT, ERPC_MESSAGE_LOGGERS_COUNT,
 //! ERPC_CLIENTS_THREADS_AMOUNT).
-// #define ERPC_ALLOCATION_POLICY (ERPC_ALLOCATION_POLICY_STATIC)
+#define ERPC_ALLOCATION_POLICY (ERPC_ALLOCATION_POLICY_STATIC)
 
 //! @def ERPC_CODEC_COUNT
 //!
@@ -119,6 +119,20 @@
 //! Default value is set to 2.
 //#define ERPC_DEFAULT_BUFFERS_COUNT (2U)
 
+//! @def ERPC_SERVER_MAX_PAYLOAD
+//!
+//! Uncomment to change the largest payload of the vectors of a psa_call request. The parameters of a request are
+//! allocated in a static arena of that size plus the vector lists (see erpc_server_arena.c). The default size is
+//! ERPC_DEFAULT_BUFFER_SIZE.
+//#define ERPC_SERVER_MAX_PAYLOAD (3072U)
+
+//! @def ERPC_SERVER_RX_QUEUE_SIZE
+//!
+//! Uncomment to change the size of the receive queue of the UART transport, when the server app is built with
+//! ERPC_SERVER_RX_QUEUE. It holds the requests sent by the client while the server handles the previous one, and must
+//! not be smaller than ERPC_PSA_CALL_ASYNC_WINDOW of the client. The default size is ERPC_DEFAULT_BUFFER_SIZE.
+//#define ERPC_SERVER_RX_QUEUE_SIZE (3072U)
+
 //! @def ERPC_NOEXCEPT
 //!
 //! @brief Disable/enable noexcept support.
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * eRPC port memory allocation for the server, from a static arena instead of
+ * the heap.
+ *
+ * The server shims allocate the decoded parameters of a request and free all
+ * of them before the reply is sent. The allocations are carved out of the
+ * arena one after the other, and the arena is emptied at once when the last
+ * one is freed. The requests never fragment the heap or wait for it.
+ *
+ * The server handles a single request at a time (ERPC_THREADS_NONE), so the
+ * arena is not protected against concurrent accesses.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "erpc_config_internal.h"
+#include "erpc_port.h"
+#include "tfm_erpc.h"
+
+/*
+ * The largest payload of in-vectors and out-vectors in a request. It can be
+ * set in the eRPC config file.
+ */
+#ifndef ERPC_SERVER_MAX_PAYLOAD
+#define ERPC_SERVER_MAX_PAYLOAD     ERPC_DEFAULT_BUFFER_SIZE
+#endif
+
+#define ARENA_ALIGN                 8
+#define ARENA_ALIGN_UP(size)        (((size) + ARENA_ALIGN - 1) & \
+                                     ~((size_t)ARENA_ALIGN - 1))
+
+/*
+ * A psa_call request allocates the list of in-vectors and the list of
+ * out-vectors, their elements and the data of each vector.
+ */
+#define ARENA_SIZE                                                   \
+    (2 * ARENA_ALIGN_UP(sizeof(list_binary_1_t)) +                   \
+     2 * ARENA_ALIGN_UP(PSA_MAX_IOVEC * sizeof(binary_t)) +          \
+     2 * PSA_MAX_IOVEC * ARENA_ALIGN + ERPC_SERVER_MAX_PAYLOAD)
+
+static uint64_t arena[ARENA_ALIGN_UP(ARENA_SIZE) / sizeof(uint64_t)];
+static size_t arena_used;
+static uint32_t nr_allocs;
+
+void *erpc_malloc(size_t size)
+{
+    void *ptr;
+
+    size = ARENA_ALIGN_UP(size);
+    if (size > sizeof(arena) - arena_used) {
+        return NULL;
+    }
+
+    ptr = (uint8_t *)arena + arena_used;
+    arena_used += size;
+    nr_allocs++;
+
+    return ptr;
+}
+
+void erpc_free(void *ptr)
+{
+    if ((ptr == NULL) || (nr_allocs == 0)) {
+        return;
+    }
+
+    /* The request is completed once all its allocations are freed */
+    if (--nr_allocs == 0) {
+        arena_used = 0;
+    }
+}
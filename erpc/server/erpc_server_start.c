@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -10,11 +10,14 @@
 #include "erpc_mbf_setup.h"
 #include "erpc_server_setup.h"
 #include "tfm_erpc_server.h"
+#include "tfm_erpc_zero_copy.h"
 
 void erpc_server_start(erpc_transport_t transport)
 {
-    erpc_server_init(transport, erpc_mbf_dynamic_init());
+    /* Message buffers are allocated once and reused by the requests */
+    erpc_server_init(transport, erpc_mbf_static_init());
     erpc_add_service_to_server(create_psa_client_api_service());
+    erpc_add_service_to_server(create_psa_zero_copy_api_service());
 
     erpc_server_run();
 
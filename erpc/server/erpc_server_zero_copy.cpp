@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "erpc_server.h"
+#include "erpc_codec.h"
+#include "erpc_manually_constructed.h"
+#include "erpc_port.h"
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+#include <new>
+#endif
+extern "C"
+{
+#include "tfm_erpc_zero_copy.h"
+}
+
+using namespace erpc;
+using namespace std;
+
+#if ERPC_NESTED_CALLS_DETECTION
+extern bool nestingDetection;
+#endif
+
+class psa_zero_copy_api_service : public erpc::Service
+{
+public:
+    psa_zero_copy_api_service() : Service(kpsa_zero_copy_api_service_id) {}
+
+    virtual erpc_status_t handleInvocation(uint32_t methodId,
+                                           uint32_t sequence,
+                                           erpc::Codec *codec,
+                                           erpc::MessageBufferFactory *messageFactory);
+
+private:
+    erpc_status_t psa_call_shim(erpc::Codec *codec,
+                                erpc::MessageBufferFactory *messageFactory,
+                                uint32_t sequence);
+
+    erpc_status_t set_nsid_shim(erpc::Codec *codec,
+                                erpc::MessageBufferFactory *messageFactory,
+                                uint32_t sequence);
+
+    erpc_status_t get_rx_window_shim(erpc::Codec *codec,
+                                     erpc::MessageBufferFactory *messageFactory,
+                                     uint32_t sequence);
+};
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+ERPC_MANUALLY_CONSTRUCTED_STATIC(psa_zero_copy_api_service,
+                                 s_psa_zero_copy_api_service);
+#endif
+
+erpc_status_t
+psa_zero_copy_api_service::handleInvocation(uint32_t methodId,
+                                            uint32_t sequence,
+                                            Codec *codec,
+                                            MessageBufferFactory *messageFactory)
+{
+    switch (methodId) {
+    case kpsa_zero_copy_api_psa_call_id:
+        return psa_call_shim(codec, messageFactory, sequence);
+    case kpsa_zero_copy_api_set_nsid_id:
+        return set_nsid_shim(codec, messageFactory, sequence);
+    case kpsa_zero_copy_api_get_rx_window_id:
+        return get_rx_window_shim(codec, messageFactory, sequence);
+    default:
+        return kErpcStatus_InvalidArgument;
+    }
+}
+
+erpc_status_t
+psa_zero_copy_api_service::psa_call_shim(Codec *codec,
+                                         MessageBufferFactory *messageFactory,
+                                         uint32_t sequence)
+{
+    erpc_status_t err;
+    psa_handle_t handle;
+    int32_t type;
+    psa_invec in_vec[PSA_MAX_IOVEC];
+    psa_outvec out_vec[PSA_MAX_IOVEC];
+    uint32_t in_len, out_len = 0, len, i;
+    uint8_t *data, *out_buf = NULL;
+    size_t out_size = 0;
+    psa_status_t result;
+
+    // startReadMessage() was already called before this shim was invoked.
+
+    codec->read(&handle);
+    codec->read(&type);
+
+    /* The in-vectors point into the received message */
+    codec->startReadList(&in_len);
+    if (in_len > PSA_MAX_IOVEC) {
+        codec->updateStatus(kErpcStatus_InvalidArgument);
+    }
+    for (i = 0; (i < in_len) && (codec->getStatus() == kErpcStatus_Success);
+         i++) {
+        codec->readBinary(&len, &data);
+        in_vec[i].base = data;
+        in_vec[i].len = len;
+    }
+
+    codec->startReadList(&out_len);
+    if ((codec->getStatus() == kErpcStatus_Success) &&
+        (out_len > PSA_MAX_IOVEC - in_len)) {
+        codec->updateStatus(kErpcStatus_InvalidArgument);
+    }
+    for (i = 0; (i < out_len) && (codec->getStatus() == kErpcStatus_Success);
+         i++) {
+        codec->read(&len);
+        out_vec[i].len = len;
+        out_size += len;
+    }
+
+    /* A single buffer holds all the out-vectors */
+    if ((codec->getStatus() == kErpcStatus_Success) && (out_size > 0)) {
+        out_buf = (uint8_t *)erpc_malloc(out_size);
+        if (out_buf == NULL) {
+            codec->updateStatus(kErpcStatus_MemoryError);
+        }
+    }
+
+    err = codec->getStatus();
+    if (err == kErpcStatus_Success) {
+        for (i = 0, data = out_buf; i < out_len; i++) {
+            out_vec[i].base = data;
+            data += out_vec[i].len;
+        }
+
+#if ERPC_NESTED_CALLS_DETECTION
+        nestingDetection = true;
+#endif
+        result = psa_call(handle, type, in_vec, in_len, out_vec, out_len);
+#if ERPC_NESTED_CALLS_DETECTION
+        nestingDetection = false;
+#endif
+
+        /* The in-vectors are not used any more once the reply is prepared */
+        err = messageFactory->prepareServerBufferForSend(codec->getBuffer());
+    }
+
+    if (err == kErpcStatus_Success) {
+        codec->reset();
+
+        codec->startWriteMessage(kReplyMessage, kpsa_zero_copy_api_service_id,
+                                 kpsa_zero_copy_api_psa_call_id, sequence);
+
+        /* The out-vectors are not updated on failure */
+        codec->startWriteList(out_len);
+        for (i = 0; i < out_len; i++) {
+            len = (result == PSA_SUCCESS) ? (uint32_t)out_vec[i].len : 0;
+            codec->writeBinary(len, (const uint8_t *)out_vec[i].base);
+        }
+
+        codec->write(result);
+
+        err = codec->getStatus();
+    }
+
+    if (out_buf != NULL) {
+        erpc_free(out_buf);
+    }
+
+    return err;
+}
+
+erpc_status_t
+psa_zero_copy_api_service::set_nsid_shim(Codec *codec,
+                                         MessageBufferFactory *messageFactory,
+                                         uint32_t sequence)
+{
+    erpc_status_t err;
+    int32_t nsid;
+    psa_status_t result;
+
+    // startReadMessage() was already called before this shim was invoked.
+
+    codec->read(&nsid);
+
+    err = codec->getStatus();
+    if (err == kErpcStatus_Success) {
+        result = erpc_server_set_nsid(nsid);
+
+        err = messageFactory->prepareServerBufferForSend(codec->getBuffer());
+    }
+
+    if (err == kErpcStatus_Success) {
+        codec->reset();
+
+        codec->startWriteMessage(kReplyMessage, kpsa_zero_copy_api_service_id,
+                                 kpsa_zero_copy_api_set_nsid_id, sequence);
+
+        codec->write(result);
+
+        err = codec->getStatus();
+    }
+
+    return err;
+}
+
+erpc_status_t
+psa_zero_copy_api_service::get_rx_window_shim(
+    Codec *codec, MessageBufferFactory *messageFactory, uint32_t sequence)
+{
+    erpc_status_t err;
+
+    // startReadMessage() was already called before this shim was invoked.
+
+    err = messageFactory->prepareServerBufferForSend(codec->getBuffer());
+    if (err == kErpcStatus_Success) {
+        codec->reset();
+
+        codec->startWriteMessage(kReplyMessage, kpsa_zero_copy_api_service_id,
+                                 kpsa_zero_copy_api_get_rx_window_id,
+                                 sequence);
+
+        codec->write(erpc_server_get_rx_window());
+
+        err = codec->getStatus();
+    }
+
+    return err;
+}
+
+/* The server applications which manage the NSIDs override it */
+__attribute__((weak)) psa_status_t erpc_server_set_nsid(int32_t nsid)
+{
+    (void)nsid;
+
+    return PSA_ERROR_NOT_SUPPORTED;
+}
+
+/* The server applications with a queued transport override it */
+__attribute__((weak)) uint32_t erpc_server_get_rx_window(void)
+{
+    return 0;
+}
+
+void *create_psa_zero_copy_api_service(void)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    return new (nothrow) psa_zero_copy_api_service();
+#else
+    s_psa_zero_copy_api_service.construct();
+    return s_psa_zero_copy_api_service.get();
+#endif
+}
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "erpc_framed_transport.h"
+#include "erpc_shm_transport.h"
+
+using namespace erpc;
+
+/* Set by the server once the ring buffers are initialized */
+#define SHM_CHANNEL_MAGIC           0x74666D73U
+
+/* Period of the checks that the server is still running, in ms */
+#define SHM_PEER_POLL_MS            100U
+
+#define NSEC_PER_MSEC               1000000L
+#define NSEC_PER_SEC                1000000000L
+
+/*
+ * A single producer and a single consumer ring buffer. The indexes run freely
+ * and are only wrapped when the data are accessed. They are only updated once
+ * the data are copied, so the ring stays consistent if a peer dies while it
+ * holds the lock.
+ */
+struct shm_ring_t {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;            /* Data written or read */
+    uint32_t head;                  /* Next byte to write */
+    uint32_t tail;                  /* Next byte to read */
+    uint8_t data[ERPC_SHM_RING_SIZE];
+};
+
+struct shm_channel_t {
+    uint32_t magic;
+    pid_t server_pid;
+    struct shm_ring_t to_server;
+    struct shm_ring_t to_client;
+};
+
+class SharedMemoryTransport : public FramedTransport
+{
+public:
+    SharedMemoryTransport(void) : m_channel(NULL), m_tx(NULL), m_rx(NULL),
+                                  m_isServer(false) {}
+
+    erpc_status_t open(const char *name, bool isServer);
+
+protected:
+    virtual erpc_status_t underlyingSend(const uint8_t *data, uint32_t size);
+    virtual erpc_status_t underlyingReceive(uint8_t *data, uint32_t size);
+
+private:
+    bool isPeerRunning(void);
+    bool wait(struct shm_ring_t *ring);
+
+    struct shm_channel_t *m_channel;
+    struct shm_ring_t *m_tx;
+    struct shm_ring_t *m_rx;
+    bool m_isServer;
+};
+
+static SharedMemoryTransport s_transport;
+static bool s_transport_used = false;
+
+static bool shm_ring_init(struct shm_ring_t *ring)
+{
+    pthread_mutexattr_t mutex_attr;
+    pthread_condattr_t cond_attr;
+    bool ret = false;
+
+    /*
+     * The peers are different processes. The lock is released if its owner
+     * dies, and the waits are timed to check that the peer is still running.
+     */
+    if (pthread_mutexattr_init(&mutex_attr) != 0) {
+        return false;
+    }
+    if (pthread_condattr_init(&cond_attr) != 0) {
+        pthread_mutexattr_destroy(&mutex_attr);
+        return false;
+    }
+
+    if ((pthread_mutexattr_setpshared(&mutex_attr,
+                                      PTHREAD_PROCESS_SHARED) == 0) &&
+        (pthread_mutexattr_setrobust(&mutex_attr,
+                                     PTHREAD_MUTEX_ROBUST) == 0) &&
+        (pthread_condattr_setpshared(&cond_attr,
+                                     PTHREAD_PROCESS_SHARED) == 0) &&
+        (pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC) == 0) &&
+        (pthread_mutex_init(&ring->lock, &mutex_attr) == 0)) {
+        if (pthread_cond_init(&ring->cond, &cond_attr) == 0) {
+            ring->head = 0;
+            ring->tail = 0;
+            ret = true;
+        } else {
+            pthread_mutex_destroy(&ring->lock);
+        }
+    }
+
+    pthread_condattr_destroy(&cond_attr);
+    pthread_mutexattr_destroy(&mutex_attr);
+
+    return ret;
+}
+
+/* A lock left by a dead owner is taken over, as the ring is consistent */
+static bool shm_ring_locked(int err, struct shm_ring_t *ring)
+{
+    if (err == EOWNERDEAD) {
+        err = pthread_mutex_consistent(&ring->lock);
+    }
+
+    return err == 0;
+}
+
+static bool shm_ring_lock(struct shm_ring_t *ring)
+{
+    return shm_ring_locked(pthread_mutex_lock(&ring->lock), ring);
+}
+
+/*
+ * The server keeps waiting for the next client when one exits. The client
+ * stops waiting when the server has exited, instead of blocking for ever.
+ */
+bool SharedMemoryTransport::isPeerRunning(void)
+{
+    if (m_isServer) {
+        return true;
+    }
+
+    return (kill(m_channel->server_pid, 0) == 0) || (errno == EPERM);
+}
+
+/* Wait with the ring locked for the peer to update it */
+bool SharedMemoryTransport::wait(struct shm_ring_t *ring)
+{
+    struct timespec deadline;
+    int err;
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_nsec += SHM_PEER_POLL_MS * NSEC_PER_MSEC;
+    if (deadline.tv_nsec >= NSEC_PER_SEC) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= NSEC_PER_SEC;
+    }
+
+    err = pthread_cond_timedwait(&ring->cond, &ring->lock, &deadline);
+    if (err == ETIMEDOUT) {
+        return isPeerRunning();
+    }
+
+    return shm_ring_locked(err, ring);
+}
+
+erpc_status_t SharedMemoryTransport::open(const char *name, bool isServer)
+{
+    struct shm_channel_t *channel;
+    int fd;
+
+    if (isServer) {
+        /* Drop the object left by a previous server */
+        (void)shm_unlink(name);
+        fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    } else {
+        fd = shm_open(name, O_RDWR, 0);
+    }
+    if (fd < 0) {
+        return kErpcStatus_InitFailed;
+    }
+
+    if (isServer && (ftruncate(fd, sizeof(*channel)) != 0)) {
+        close(fd);
+        return kErpcStatus_InitFailed;
+    }
+
+    channel = (struct shm_channel_t *)mmap(NULL, sizeof(*channel),
+                                           PROT_READ | PROT_WRITE, MAP_SHARED,
+                                           fd, 0);
+    close(fd);
+    if (channel == MAP_FAILED) {
+        return kErpcStatus_InitFailed;
+    }
+
+    if (isServer) {
+        if (!shm_ring_init(&channel->to_server) ||
+            !shm_ring_init(&channel->to_client)) {
+            munmap(channel, sizeof(*channel));
+            return kErpcStatus_InitFailed;
+        }
+
+        channel->server_pid = getpid();
+        __atomic_store_n(&channel->magic, SHM_CHANNEL_MAGIC, __ATOMIC_RELEASE);
+
+        m_tx = &channel->to_client;
+        m_rx = &channel->to_server;
+    } else {
+        if (__atomic_load_n(&channel->magic, __ATOMIC_ACQUIRE) !=
+            SHM_CHANNEL_MAGIC) {
+            munmap(channel, sizeof(*channel));
+            return kErpcStatus_InitFailed;
+        }
+
+        m_tx = &channel->to_server;
+        m_rx = &channel->to_client;
+    }
+
+    m_channel = channel;
+    m_isServer = isServer;
+
+    return kErpcStatus_Success;
+}
+
+erpc_status_t SharedMemoryTransport::underlyingSend(const uint8_t *data,
+                                                    uint32_t size)
+{
+    uint32_t len, idx, chunk;
+
+    if (!shm_ring_lock(m_tx)) {
+        return kErpcStatus_SendFailed;
+    }
+
+    while (size > 0) {
+        while (m_tx->head - m_tx->tail == ERPC_SHM_RING_SIZE) {
+            if (!wait(m_tx)) {
+                pthread_mutex_unlock(&m_tx->lock);
+                return kErpcStatus_ConnectionClosed;
+            }
+        }
+
+        len = ERPC_SHM_RING_SIZE - (m_tx->head - m_tx->tail);
+        if (len > size) {
+            len = size;
+        }
+
+        idx = m_tx->head & (ERPC_SHM_RING_SIZE - 1);
+        chunk = (len < ERPC_SHM_RING_SIZE - idx) ? len :
+                                                    ERPC_SHM_RING_SIZE - idx;
+        memcpy(&m_tx->data[idx], data, chunk);
+        memcpy(&m_tx->data[0], data + chunk, len - chunk);
+
+        m_tx->head += len;
+        data += len;
+        size -= len;
+
+        pthread_cond_broadcast(&m_tx->cond);
+    }
+
+    pthread_mutex_unlock(&m_tx->lock);
+
+    return kErpcStatus_Success;
+}
+
+erpc_status_t SharedMemoryTransport::underlyingReceive(uint8_t *data,
+                                                       uint32_t size)
+{
+    uint32_t len, idx, chunk;
+
+    if (!shm_ring_lock(m_rx)) {
+        return kErpcStatus_ReceiveFailed;
+    }
+
+    while (size > 0) {
+        while (m_rx->head == m_rx->tail) {
+            if (!wait(m_rx)) {
+                pthread_mutex_unlock(&m_rx->lock);
+                return kErpcStatus_ConnectionClosed;
+            }
+        }
+
+        len = m_rx->head - m_rx->tail;
+        if (len > size) {
+            len = size;
+        }
+
+        idx = m_rx->tail & (ERPC_SHM_RING_SIZE - 1);
+        chunk = (len < ERPC_SHM_RING_SIZE - idx) ? len :
+                                                    ERPC_SHM_RING_SIZE - idx;
+        memcpy(data, &m_rx->data[idx], chunk);
+        memcpy(data + chunk, &m_rx->data[0], len - chunk);
+
+        m_rx->tail += len;
+        data += len;
+        size -= len;
+
+        pthread_cond_broadcast(&m_rx->cond);
+    }
+
+    pthread_mutex_unlock(&m_rx->lock);
+
+    return kErpcStatus_Success;
+}
+
+erpc_transport_t erpc_transport_shm_init(const char *name, bool is_server)
+{
+    if ((name == NULL) || s_transport_used) {
+        return NULL;
+    }
+
+    if (s_transport.open(name, is_server) != kErpcStatus_Success) {
+        return NULL;
+    }
+
+    s_transport_used = true;
+
+    return reinterpret_cast<erpc_transport_t>(&s_transport);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __ERPC_SHM_TRANSPORT_H__
+#define __ERPC_SHM_TRANSPORT_H__
+
+#include <stdbool.h>
+#include "erpc_transport_setup.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Shared memory object used when none is given */
+#define ERPC_SHM_DEFAULT_NAME       "/tfm_erpc"
+
+/*
+ * Size of the ring buffer in each direction. The server keeps receiving into
+ * it while it handles a request. It must be a power of 2.
+ */
+#define ERPC_SHM_RING_SIZE          (64U * 1024U)
+
+/**
+ * \brief Initialize the shared memory transport of eRPC.
+ *
+ * The client and the server exchange the messages through a pair of ring
+ * buffers in a POSIX shared memory object, on a single host. It removes the
+ * link speed from the measurements of the eRPC protocol overhead.
+ *
+ * \note  The server creates the shared memory object, which must be done
+ *        before the client opens it.
+ *
+ * \note  The transfers of the client fail with kErpcStatus_ConnectionClosed
+ *        once the server process has exited. The server keeps waiting for
+ *        the next client.
+ *
+ * \param[in] name              Name of the POSIX shared memory object.
+ * \param[in] is_server         True on the server side.
+ *
+ * \return The transport, or NULL in case of error.
+ */
+erpc_transport_t erpc_transport_shm_init(const char *name, bool is_server);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ERPC_SHM_TRANSPORT_H__ */
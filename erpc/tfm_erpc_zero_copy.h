@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Zero-copy psa_call over eRPC.
+ *
+ * The generated erpc_psa_call takes the out-vectors as an inout list of
+ * binaries. The whole content of the caller output buffers is sent to the
+ * server, which allocates and copies every vector of the request before it
+ * calls psa_call. The client then copies the out-vectors of the reply once
+ * more from the decoded list.
+ *
+ * This service is written by hand instead, with the following messages:
+ *
+ *   Request: handle, type, list of in-vector binaries,
+ *            list of out-vector sizes
+ *   Reply:   list of out-vector binaries, status
+ *
+ * The client encodes the in-vectors straight from the caller buffers and
+ * decodes the out-vectors of the reply straight into them. Only the sizes of
+ * the out-vectors are sent. The server calls psa_call with in-vectors which
+ * point into the received message, so that a request is never copied.
+ *
+ * The service also selects the NSID the server makes the next PSA client
+ * calls with, so that the host threads are seen as distinct NS clients:
+ *
+ *   Request: NSID
+ *   Reply:   status
+ *
+ * The client reads the number of bytes the server can queue while it is busy,
+ * before it pipelines its psa_call requests:
+ *
+ *   Request: none
+ *   Reply:   size of the receive queue in bytes, 0 without a queue
+ */
+
+#ifndef __TFM_ERPC_ZERO_COPY_H__
+#define __TFM_ERPC_ZERO_COPY_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "psa/client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Identifiers of the zero-copy service, next to the generated psa_client_api */
+enum _psa_zero_copy_api_ids
+{
+    kpsa_zero_copy_api_service_id = 2,
+    kpsa_zero_copy_api_psa_call_id = 1,
+    kpsa_zero_copy_api_set_nsid_id = 2,
+    kpsa_zero_copy_api_get_rx_window_id = 3,
+};
+
+/**
+ * \brief Call a secure service through the zero-copy eRPC service.
+ *
+ * \note  The parameters and return values are the same as psa_call().
+ */
+psa_status_t erpc_psa_call_zero_copy(psa_handle_t handle, int32_t type,
+                                     const psa_invec *in_vec, size_t in_len,
+                                     psa_outvec *out_vec, size_t out_len);
+
+/**
+ * \brief Make the next PSA client calls of the server with the given NSID.
+ *
+ * \param[in] nsid              NSID of the calling client thread.
+ *
+ * \retval PSA_SUCCESS                      The NSID is selected.
+ * \retval PSA_ERROR_NOT_SUPPORTED          The server does not manage NSIDs.
+ * \retval PSA_ERROR_INVALID_ARGUMENT       The NSID is not negative.
+ * \retval PSA_ERROR_COMMUNICATION_FAILURE  The request could not be sent.
+ */
+psa_status_t erpc_client_set_nsid(int32_t nsid);
+
+/**
+ * \brief Select the NSID of the next PSA client calls on the server side.
+ *
+ * \details The default implementation returns PSA_ERROR_NOT_SUPPORTED. The
+ *          server application overrides it when it manages the NSIDs. It is
+ *          called from the server thread, which makes the PSA client calls.
+ *
+ * \param[in] nsid              NSID requested by the client.
+ *
+ * \return The status returned to erpc_client_set_nsid().
+ */
+psa_status_t erpc_server_set_nsid(int32_t nsid);
+
+/**
+ * \brief Get the number of bytes the server transport receives while the
+ *        server handles a request.
+ *
+ * \details The default implementation returns 0: the requests sent before the
+ *          reply of the previous one are lost. The server application
+ *          overrides it when its transport queues the received bytes.
+ *
+ * \return The size of the receive queue, reported to the client to bound the
+ *         pipelined calls.
+ */
+uint32_t erpc_server_get_rx_window(void);
+
+/**
+ * \brief Create the server side of the zero-copy service, to be added to the
+ *        eRPC server.
+ *
+ * \return The service, or NULL in case of error.
+ */
+void *create_psa_zero_copy_api_service(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TFM_ERPC_ZERO_COPY_H__ */
@@ -4,6 +4,10 @@
  *
  */
 
+/* For pthread_getname_np() */
+#define _GNU_SOURCE
+
+#include <getopt.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -14,44 +18,127 @@
 #include "tfm_erpc.h"
 
 #include "non_secure_suites.h"
+#include "test_framework.h"
+
+#ifdef ERPC_TRANSPORT_SHM
+#include "erpc_shm_transport.h"
+#endif
 
-#if (!defined(ERPC_TRANSPORT_UART)) && (!defined(ERPC_TRANSPORT_TCP))
+#ifdef ERPC_HOST_OS_WRAPPER
+#include <pthread.h>
+#include "erpc_client_setup.h"
+#include "os_wrapper/mutex.h"
+#ifdef TFM_NS_MANAGE_NSID
+#include "tfm_erpc_zero_copy.h"
+#include "tfm_nsid_manager.h"
+#include "tfm_nsid_map_table.h"
+#endif
+#endif /* ERPC_HOST_OS_WRAPPER */
+
+#if (!defined(ERPC_TRANSPORT_UART)) && (!defined(ERPC_TRANSPORT_TCP)) && \
+    (!defined(ERPC_TRANSPORT_SHM))
 #include <stdlib.h>
-#include <getopt.h>
+#endif /* !ERPC_TRANSPORT_UART && !ERPC_TRANSPORT_TCP && !ERPC_TRANSPORT_SHM */
+
+#define OPT_FILTER  'f'
+
+#ifdef ERPC_HOST_OS_WRAPPER
+/* The same as the thread names on the RTOS, NUL included */
+#define THREAD_NAME_LEN     16
+
+/*
+ * The eRPC client handles one call at a time. The test threads of the host
+ * take turns in the pre and post actions of the client calls.
+ */
+static void *erpc_call_mutex;
+
+#ifdef TFM_NS_MANAGE_NSID
+/* The NSID the server makes the calls with, unknown at start */
+static int32_t erpc_call_nsid = TFM_INVALID_NSID_MIN;
+
+/* The server makes the next calls with the NSID of the calling thread */
+static void erpc_call_select_nsid(void)
+{
+    char name[THREAD_NAME_LEN];
+    int32_t nsid;
+
+    if (pthread_getname_np(pthread_self(), name, sizeof(name)) != 0) {
+        name[0] = '\0';
+    }
+
+    nsid = nsid_mgr_get_thread_nsid(name);
+    if (nsid == erpc_call_nsid) {
+        return;
+    }
+
+    if (erpc_client_set_nsid(nsid) == PSA_SUCCESS) {
+        erpc_call_nsid = nsid;
+    } else {
+        printf("Failed to select NSID %d on the server\r\n", nsid);
+    }
+}
+#endif /* TFM_NS_MANAGE_NSID */
+
+static void erpc_call_pre_action(void)
+{
+    (void)os_wrapper_mutex_acquire(erpc_call_mutex, OS_WRAPPER_WAIT_FOREVER);
+
+#ifdef TFM_NS_MANAGE_NSID
+    erpc_call_select_nsid();
+#endif
+}
 
-#define ARGC_UART   3
-#define ARGC_TCP    4
-#endif /* !ERPC_TRANSPORT_UART && !ERPC_TRANSPORT_TCP */
+static void erpc_call_post_action(void)
+{
+    (void)os_wrapper_mutex_release(erpc_call_mutex);
+}
+#endif /* ERPC_HOST_OS_WRAPPER */
 
 int main(int argc, char *argv[])
 {
     erpc_transport_t transport;
+    int opt;
+    char *test_filter = NULL;
 
-#if (!defined(ERPC_TRANSPORT_UART)) && (!defined(ERPC_TRANSPORT_TCP))
+#if (!defined(ERPC_TRANSPORT_UART)) && (!defined(ERPC_TRANSPORT_TCP)) && \
+    (!defined(ERPC_TRANSPORT_SHM))
     int erpc_uart_flag = 0, erpc_tcp_flag = 0;
     char *uart_dev = NULL, *tcp_host = NULL, *tcp_port = NULL;
+#endif /* !ERPC_TRANSPORT_UART && !ERPC_TRANSPORT_TCP && !ERPC_TRANSPORT_SHM */
     struct option erpc_transport_options[] =
     {
+#if (!defined(ERPC_TRANSPORT_UART)) && (!defined(ERPC_TRANSPORT_TCP)) && \
+    (!defined(ERPC_TRANSPORT_SHM))
         {"UART", no_argument, &erpc_uart_flag, 1},
         {"TCP", no_argument, &erpc_tcp_flag, 1},
+#endif /* !ERPC_TRANSPORT_UART && !ERPC_TRANSPORT_TCP && !ERPC_TRANSPORT_SHM */
+        {"filter", required_argument, NULL, OPT_FILTER},
         {0, 0, 0, 0}
     };
-#endif /* !ERPC_TRANSPORT_UART && !ERPC_TRANSPORT_TCP */
+
+    /* Loop check to set _flag and parse arguments */
+    while ((opt = getopt_long(argc, argv, "", erpc_transport_options,
+                              NULL)) != -1) {
+        if (opt == OPT_FILTER) {
+            test_filter = optarg;
+        } else if (opt != 0) {
+            printf("Usage: %s [--filter PATTERN[,PATTERN...]]"
+#if (!defined(ERPC_TRANSPORT_UART)) && (!defined(ERPC_TRANSPORT_TCP)) && \
+    (!defined(ERPC_TRANSPORT_SHM))
+                   " --UART PORT | --TCP HOST PORT"
+#endif
+                   "\r\n", argv[0]);
+            return 1;
+        }
+    }
 
 #ifdef ERPC_TRANSPORT_UART
     transport = erpc_transport_serial_init(PORT_NAME, 115200);
 #elif defined(ERPC_TRANSPORT_TCP)
     transport = erpc_transport_tcp_init(ERPC_HOST, ERPC_PORT, false);
+#elif defined(ERPC_TRANSPORT_SHM)
+    transport = erpc_transport_shm_init(ERPC_SHM_NAME, false);
 #else
-    /* Check if argc is correct */
-    if (argc != ARGC_UART && argc != ARGC_TCP) {
-        printf("Incorrect argument numbers.\r\n");
-        printf("Please input --UART PORT or --TCP HOST PORT\r\n");
-        return 1;
-    }
-
-    /* Loop check to set _flag and parse arguments */
-    while (getopt_long(argc, argv, "", erpc_transport_options, NULL) != -1);
     if (!erpc_uart_flag && !erpc_tcp_flag) {
         printf("No valid transportation layer selected.\r\n");
         return 1;
@@ -67,7 +154,7 @@ int main(int argc, char *argv[])
     } else if (erpc_tcp_flag) {
         if (argc - optind != 2) {
             printf("Incorrect argument numbers for --TCP.\r\n");
-        return 1;
+            return 1;
         }
         tcp_host = argv[optind];
         tcp_port = argv[optind + 1];
@@ -81,7 +168,7 @@ int main(int argc, char *argv[])
         printf("TCP connection is being set to %s:%s\r\n", tcp_host, tcp_port);
         transport = erpc_transport_tcp_init(tcp_host, atoi(tcp_port), false);
     }
-#endif /* !ERPC_TRANSPORT_UART && !ERPC_TRANSPORT_TCP */
+#endif /* !ERPC_TRANSPORT_UART && !ERPC_TRANSPORT_TCP && !ERPC_TRANSPORT_SHM */
 
     if (!transport) {
         printf("eRPC transport initialization failed!\r\n");
@@ -92,8 +179,23 @@ int main(int argc, char *argv[])
 
     erpc_client_start(transport);
 
+#ifdef ERPC_HOST_OS_WRAPPER
+    erpc_call_mutex = os_wrapper_mutex_create();
+    if (!erpc_call_mutex) {
+        printf("eRPC call mutex creation failed!\r\n");
+        return 1;
+    }
+
+    erpc_client_add_pre_cb_action(erpc_call_pre_action);
+    erpc_client_add_post_cb_action(erpc_call_post_action);
+#endif
+
     printf("psa_framework_version: 0x%x\r\n", psa_framework_version());
 
+    if (test_filter != NULL) {
+        set_test_filter(test_filter);
+    }
+
     ns_reg_test_start();
 
     return 0;
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Unit test of the token table of the NSID manager, run on the host with
+ * ctest. The source file is included to reach the hash and the table, so that
+ * the tokens can be picked to collide.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "tfm_nsid_manager.c"
+
+/* The home entry of the collision chain wraps around the end of the table */
+#define TEST_HOME               (NSID_MGR_TABLE_SIZE - 1)
+#define TEST_NR_CHAIN           3
+#define TEST_NR_TOKENS          (TEST_NR_CHAIN + 1)
+
+#if THREAD_NUM_MAX < TEST_NR_TOKENS
+#error "The NSID map table is too small for the test"
+#endif
+
+#define TEST_CHECK(cond, msg)                                       \
+    do {                                                            \
+        if (!(cond)) {                                              \
+            printf("FAILED: %s\r\n", (msg));                        \
+            return false;                                           \
+        }                                                           \
+    } while (0)
+
+/* Tokens A, B and C share a home entry, D is homed at the next entry */
+static uint32_t tokens[TEST_NR_TOKENS];
+static bool in_table[TEST_NR_TOKENS];
+
+static bool find_tokens(void)
+{
+    uint32_t token, nr_chain = 0;
+    bool next_found = false;
+
+    for (token = 0; (nr_chain < TEST_NR_CHAIN) || !next_found; token++) {
+        TEST_CHECK(token != TFM_NS_CLIENT_INVALID_TOKEN, "Colliding tokens");
+
+        if ((token_hash(token) == TEST_HOME) && (nr_chain < TEST_NR_CHAIN)) {
+            tokens[nr_chain++] = token;
+        } else if ((token_hash(token) == next_entry(TEST_HOME)) &&
+                   !next_found) {
+            tokens[TEST_NR_CHAIN] = token;
+            next_found = true;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Check that the tokens in the table are found with their NSID, the others are
+ * not, and that no free entry lies between a token and its home entry.
+ */
+static bool check_table(void)
+{
+    uint32_t i, idx, nr_entries = 0;
+
+    for (i = 0; i < TEST_NR_TOKENS; i++) {
+        if (in_table[i]) {
+            TEST_CHECK(nsid_mgr_query_nsid(tokens[i]) == -(int32_t)(i + 2),
+                       "Token found with its NSID");
+            TEST_CHECK(nsid_mgr_query_thread_id(tokens[i]) == i + 1,
+                       "Token found with its thread ID");
+        } else {
+            TEST_CHECK(nsid_mgr_query_nsid(tokens[i]) == TFM_INVALID_NSID_MIN,
+                       "Removed token not found");
+        }
+    }
+
+    for (i = 0; i < NSID_MGR_TABLE_SIZE; i++) {
+        if (test_ns_token_table[i].token == TFM_NS_CLIENT_INVALID_TOKEN) {
+            continue;
+        }
+
+        nr_entries++;
+        for (idx = token_hash(test_ns_token_table[i].token); idx != i;
+             idx = next_entry(idx)) {
+            TEST_CHECK(test_ns_token_table[idx].token !=
+                       TFM_NS_CLIENT_INVALID_TOKEN, "Unbroken probe sequence");
+        }
+    }
+
+    TEST_CHECK(nr_entries == nr_token_entries, "Number of entries");
+
+    return true;
+}
+
+static bool add_token(uint32_t i)
+{
+    TEST_CHECK(nsid_mgr_add_entry(-(int32_t)(i + 2), tokens[i], i + 1) ==
+               NSID_MGR_ERR_SUCCESS, "Token added");
+    in_table[i] = true;
+
+    return check_table();
+}
+
+static bool remove_token(uint32_t i)
+{
+    TEST_CHECK(nsid_mgr_remove_entry(tokens[i]) == NSID_MGR_ERR_SUCCESS,
+               "Token removed");
+    in_table[i] = false;
+
+    return check_table();
+}
+
+static bool test_collision_chain(void)
+{
+    uint32_t i;
+
+    TEST_CHECK(nsid_mgr_init() == NSID_MGR_ERR_SUCCESS, "Table init");
+    TEST_CHECK(find_tokens(), "Tokens picked");
+
+    /* A, B and C fill the chain from the last entry, D is pushed past it */
+    for (i = 0; i < TEST_NR_TOKENS; i++) {
+        TEST_CHECK(add_token(i), "Collision chain built");
+    }
+    TEST_CHECK(test_ns_token_table[TEST_HOME].token == tokens[0] &&
+               test_ns_token_table[2].token == tokens[3],
+               "Collision chain wraps around");
+
+    /* Removing the head moves B, C and D back across the end of the table */
+    TEST_CHECK(remove_token(0), "Head of the chain removed");
+    TEST_CHECK(test_ns_token_table[TEST_HOME].token == tokens[1] &&
+               test_ns_token_table[1].token == tokens[3],
+               "Chain shifted back");
+
+    /* C leaves the home entry of D, which moves back to it */
+    TEST_CHECK(remove_token(2), "Middle of the chain removed");
+    TEST_CHECK(test_ns_token_table[0].token == tokens[3] &&
+               test_ns_token_table[1].token == TFM_NS_CLIENT_INVALID_TOKEN,
+               "Entry moved back to its home entry");
+
+    TEST_CHECK(nsid_mgr_remove_entry(tokens[0]) == NSID_MGR_ERR_INVALID_TOKEN,
+               "Missing token not removed");
+
+    TEST_CHECK(add_token(0), "Token added again");
+    TEST_CHECK(remove_token(3), "Tail of the chain removed");
+    TEST_CHECK(remove_token(1), "Chain emptied");
+    TEST_CHECK(remove_token(0), "Table emptied");
+
+    return true;
+}
+
+static bool test_full_table(void)
+{
+    uint32_t token;
+
+    TEST_CHECK(nsid_mgr_init() == NSID_MGR_ERR_SUCCESS, "Table init");
+
+    for (token = 0; token < THREAD_NUM_MAX; token++) {
+        TEST_CHECK(nsid_mgr_add_entry(TFM_DEFAULT_NSID, token, 0) ==
+                   NSID_MGR_ERR_SUCCESS, "Token added");
+    }
+
+    TEST_CHECK(nsid_mgr_add_entry(TFM_DEFAULT_NSID, token, 0) ==
+               NSID_MGR_ERR_NO_FREE_ENTRY, "Token rejected by a full table");
+    TEST_CHECK(nsid_mgr_add_entry(-2, 0, 1) == NSID_MGR_ERR_SUCCESS,
+               "Token updated in a full table");
+    TEST_CHECK(nsid_mgr_query_nsid(0) == -2, "Updated NSID");
+
+    return true;
+}
+
+int main(void)
+{
+    if (!test_collision_chain() || !test_full_table()) {
+        return 1;
+    }
+
+    printf("PASSED\r\n");
+
+    return 0;
+}
@@ -0,0 +1,752 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* For pthread_setname_np() */
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "thread.h"
+#include "os_wrapper/mutex.h"
+#include "semaphore.h"
+#include "delay.h"
+#include "msg_queue.h"
+#include "tick.h"
+
+/*
+ * This is an example OS abstraction layer for POSIX threads, to run the NS
+ * tests natively on a host against the eRPC client.
+ *
+ * A tick is 1 ms of CLOCK_MONOTONIC. The thread priorities are recorded for
+ * os_wrapper_thread_get_priority() but are not enforced, as the host
+ * scheduler usually does not allow real-time priorities. The stack size
+ * requested by the caller is sized for the embedded targets, so the threads
+ * are created with the default stack size of the host.
+ *
+ * The threads are named as on the RTOS, up to the length allowed by the host.
+ * The handle of a thread stays valid after it exits, until
+ * os_wrapper_thread_join() releases it.
+ */
+
+/* The same value as osPriorityNormal in CMSIS-RTOS v2 */
+#define POSIX_DEFAULT_PRIORITY          24U
+
+#define NSEC_PER_MSEC                   1000000L
+#define NSEC_PER_SEC                    1000000000L
+
+/* Including the terminating NUL, the limit of pthread_setname_np() */
+#define POSIX_THREAD_NAME_LEN           16
+
+struct posix_thread_t {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;            /* Signalled when a flag is set */
+    uint32_t flags;                 /* Pending event flags */
+    uint32_t priority;
+    os_wrapper_thread_func func;    /* NULL for the adopted threads */
+    void *arg;
+    bool exited;                    /* Signalled when the thread exits */
+    char name[POSIX_THREAD_NAME_LEN];
+};
+
+struct posix_semaphore_t {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;            /* Signalled when a token is released */
+    uint32_t count;
+    uint32_t max_count;
+};
+
+struct posix_msg_queue_t {
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    size_t msg_size;
+    uint8_t msg_count;
+    uint8_t nr_msgs;
+    uint8_t *prio;                  /* Priority of each queued message */
+    uint8_t *msgs;                  /* Messages ordered by priority */
+};
+
+static pthread_key_t thread_key;
+static pthread_once_t thread_key_once = PTHREAD_ONCE_INIT;
+
+/* The conditions wait on CLOCK_MONOTONIC, the same clock as the ticks */
+static int init_cond(pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+    int ret;
+
+    if (pthread_condattr_init(&attr) != 0) {
+        return -1;
+    }
+
+    ret = pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    if (ret == 0) {
+        ret = pthread_cond_init(cond, &attr);
+    }
+
+    pthread_condattr_destroy(&attr);
+
+    return (ret == 0) ? 0 : -1;
+}
+
+static void get_deadline(clockid_t clock_id, uint32_t timeout,
+                         struct timespec *deadline)
+{
+    clock_gettime(clock_id, deadline);
+
+    deadline->tv_sec += timeout / 1000;
+    deadline->tv_nsec += (long)(timeout % 1000) * NSEC_PER_MSEC;
+    if (deadline->tv_nsec >= NSEC_PER_SEC) {
+        deadline->tv_sec++;
+        deadline->tv_nsec -= NSEC_PER_SEC;
+    }
+}
+
+/*
+ * Wait for the condition until the deadline, or forever with
+ * OS_WRAPPER_WAIT_FOREVER. Return false when the deadline has passed.
+ */
+static bool wait_cond(pthread_cond_t *cond, pthread_mutex_t *lock,
+                      uint32_t timeout, const struct timespec *deadline)
+{
+    if (timeout == 0) {
+        return false;
+    }
+
+    if (timeout == OS_WRAPPER_WAIT_FOREVER) {
+        pthread_cond_wait(cond, lock);
+        return true;
+    }
+
+    return pthread_cond_timedwait(cond, lock, deadline) != ETIMEDOUT;
+}
+
+static void free_thread(void *handle)
+{
+    struct posix_thread_t *thread = handle;
+
+    pthread_cond_destroy(&thread->cond);
+    pthread_mutex_destroy(&thread->lock);
+    free(thread);
+}
+
+/*
+ * Called when a thread exits, whether it returns or calls
+ * os_wrapper_thread_exit(). The handle of a created thread is kept for
+ * os_wrapper_thread_join(), as the other threads can still refer to it.
+ */
+static void exit_thread(void *handle)
+{
+    struct posix_thread_t *thread = handle;
+
+    if (!thread->func) {
+        free_thread(thread);
+        return;
+    }
+
+    pthread_mutex_lock(&thread->lock);
+    thread->exited = true;
+    pthread_cond_broadcast(&thread->cond);
+    pthread_mutex_unlock(&thread->lock);
+}
+
+static void create_thread_key(void)
+{
+    (void)pthread_key_create(&thread_key, exit_thread);
+}
+
+static struct posix_thread_t *alloc_thread(const char *name,
+                                           os_wrapper_thread_func func,
+                                           void *arg, uint32_t priority)
+{
+    struct posix_thread_t *thread;
+
+    thread = calloc(1, sizeof(*thread));
+    if (!thread) {
+        return NULL;
+    }
+
+    if (pthread_mutex_init(&thread->lock, NULL) != 0) {
+        free(thread);
+        return NULL;
+    }
+
+    if (init_cond(&thread->cond) != 0) {
+        pthread_mutex_destroy(&thread->lock);
+        free(thread);
+        return NULL;
+    }
+
+    thread->priority = priority;
+    thread->func = func;
+    thread->arg = arg;
+
+    if (name) {
+        strncpy(thread->name, name, sizeof(thread->name) - 1);
+    }
+
+    return thread;
+}
+
+static void *thread_entry(void *handle)
+{
+    struct posix_thread_t *thread = handle;
+
+    /* The thread is marked as exited when it terminates */
+    (void)pthread_setspecific(thread_key, thread);
+
+    if (thread->name[0] != '\0') {
+        (void)pthread_setname_np(pthread_self(), thread->name);
+    }
+
+    thread->func(thread->arg);
+
+    return NULL;
+}
+
+void *os_wrapper_thread_new(const char *name, int32_t stack_size,
+                            os_wrapper_thread_func func, void *arg,
+                            uint32_t priority)
+{
+    struct posix_thread_t *thread;
+    pthread_attr_t attr;
+    pthread_t id;
+    int ret;
+
+    (void)stack_size;
+
+    if (!func || (pthread_once(&thread_key_once, create_thread_key) != 0)) {
+        return NULL;
+    }
+
+    thread = alloc_thread(name, func, arg, priority);
+    if (!thread) {
+        return NULL;
+    }
+
+    /* The same as osThreadDetached */
+    if (pthread_attr_init(&attr) != 0) {
+        free_thread(thread);
+        return NULL;
+    }
+
+    ret = pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    if (ret == 0) {
+        ret = pthread_create(&id, &attr, thread_entry, thread);
+    }
+
+    pthread_attr_destroy(&attr);
+
+    if (ret != 0) {
+        free_thread(thread);
+        return NULL;
+    }
+
+    return thread;
+}
+
+void *os_wrapper_semaphore_create(uint32_t max_count, uint32_t initial_count,
+                                  const char *name)
+{
+    struct posix_semaphore_t *sema;
+
+    (void)name;
+
+    if (!max_count || (initial_count > max_count)) {
+        return NULL;
+    }
+
+    sema = calloc(1, sizeof(*sema));
+    if (!sema) {
+        return NULL;
+    }
+
+    if (pthread_mutex_init(&sema->lock, NULL) != 0) {
+        free(sema);
+        return NULL;
+    }
+
+    if (init_cond(&sema->cond) != 0) {
+        pthread_mutex_destroy(&sema->lock);
+        free(sema);
+        return NULL;
+    }
+
+    sema->count = initial_count;
+    sema->max_count = max_count;
+
+    return sema;
+}
+
+uint32_t os_wrapper_semaphore_acquire(void *handle, uint32_t timeout)
+{
+    struct posix_semaphore_t *sema = handle;
+    struct timespec deadline;
+    uint32_t ret = OS_WRAPPER_SUCCESS;
+
+    if (!sema) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    get_deadline(CLOCK_MONOTONIC, timeout, &deadline);
+
+    pthread_mutex_lock(&sema->lock);
+
+    while (!sema->count) {
+        if (!wait_cond(&sema->cond, &sema->lock, timeout, &deadline)) {
+            ret = OS_WRAPPER_ERROR;
+            break;
+        }
+    }
+
+    if (ret == OS_WRAPPER_SUCCESS) {
+        sema->count--;
+    }
+
+    pthread_mutex_unlock(&sema->lock);
+
+    return ret;
+}
+
+uint32_t os_wrapper_semaphore_release(void *handle)
+{
+    struct posix_semaphore_t *sema = handle;
+    uint32_t ret = OS_WRAPPER_SUCCESS;
+
+    if (!sema) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    pthread_mutex_lock(&sema->lock);
+
+    if (sema->count < sema->max_count) {
+        sema->count++;
+        pthread_cond_signal(&sema->cond);
+    } else {
+        ret = OS_WRAPPER_ERROR;
+    }
+
+    pthread_mutex_unlock(&sema->lock);
+
+    return ret;
+}
+
+uint32_t os_wrapper_semaphore_delete(void *handle)
+{
+    struct posix_semaphore_t *sema = handle;
+
+    if (!sema) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    pthread_cond_destroy(&sema->cond);
+    pthread_mutex_destroy(&sema->lock);
+    free(sema);
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+void *os_wrapper_mutex_create(void)
+{
+    pthread_mutexattr_t attr;
+    pthread_mutex_t *mutex;
+    int ret;
+
+    mutex = malloc(sizeof(*mutex));
+    if (!mutex) {
+        return NULL;
+    }
+
+    if (pthread_mutexattr_init(&attr) != 0) {
+        free(mutex);
+        return NULL;
+    }
+
+    /* Priority inheritance, as in the CMSIS-RTOS v2 wrapper */
+    ret = pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+    if (ret == 0) {
+        ret = pthread_mutex_init(mutex, &attr);
+    }
+
+    pthread_mutexattr_destroy(&attr);
+
+    if (ret != 0) {
+        free(mutex);
+        return NULL;
+    }
+
+    return mutex;
+}
+
+uint32_t os_wrapper_mutex_acquire(void *handle, uint32_t timeout)
+{
+    struct timespec deadline;
+    int ret;
+
+    if (!handle) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    if (timeout == OS_WRAPPER_WAIT_FOREVER) {
+        ret = pthread_mutex_lock(handle);
+    } else if (timeout == 0) {
+        ret = pthread_mutex_trylock(handle);
+    } else {
+        /* pthread_mutex_timedlock() only waits on CLOCK_REALTIME */
+        get_deadline(CLOCK_REALTIME, timeout, &deadline);
+        ret = pthread_mutex_timedlock(handle, &deadline);
+    }
+
+    if (ret != 0) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+uint32_t os_wrapper_mutex_release(void *handle)
+{
+    if (!handle) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    if (pthread_mutex_unlock(handle) != 0) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+uint32_t os_wrapper_mutex_delete(void *handle)
+{
+    if (!handle) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    if (pthread_mutex_destroy(handle) != 0) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    free(handle);
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+/*
+ * The threads not created by os_wrapper_thread_new(), such as the main thread,
+ * get a handle on their first call. It is freed when the thread exits.
+ */
+void *os_wrapper_thread_get_handle(void)
+{
+    struct posix_thread_t *thread;
+
+    if (pthread_once(&thread_key_once, create_thread_key) != 0) {
+        return NULL;
+    }
+
+    thread = pthread_getspecific(thread_key);
+    if (thread) {
+        return thread;
+    }
+
+    thread = alloc_thread(NULL, NULL, NULL, POSIX_DEFAULT_PRIORITY);
+    if (!thread) {
+        return NULL;
+    }
+
+    if (pthread_setspecific(thread_key, thread) != 0) {
+        free_thread(thread);
+        return NULL;
+    }
+
+    return thread;
+}
+
+uint32_t os_wrapper_thread_get_priority(void *handle, uint32_t *priority)
+{
+    struct posix_thread_t *thread = handle;
+
+    if (!thread || !priority) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    *priority = thread->priority;
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+void os_wrapper_thread_exit(void)
+{
+    pthread_exit(NULL);
+}
+
+uint32_t os_wrapper_thread_join(void *handle)
+{
+    struct posix_thread_t *thread = handle;
+
+    /* Only the created threads can be joined, and not by themselves */
+    if (!thread || !thread->func ||
+        (thread == pthread_getspecific(thread_key))) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    pthread_mutex_lock(&thread->lock);
+    while (!thread->exited) {
+        pthread_cond_wait(&thread->cond, &thread->lock);
+    }
+    pthread_mutex_unlock(&thread->lock);
+
+    free_thread(thread);
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+uint32_t os_wrapper_thread_set_flag(void *handle, uint32_t flags)
+{
+    struct posix_thread_t *thread = handle;
+
+    if (!thread) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    pthread_mutex_lock(&thread->lock);
+    thread->flags |= flags;
+    pthread_cond_broadcast(&thread->cond);
+    pthread_mutex_unlock(&thread->lock);
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+/* There is no interrupt context on the host */
+uint32_t os_wrapper_thread_set_flag_isr(void *handle, uint32_t flags)
+{
+    return os_wrapper_thread_set_flag(handle, flags);
+}
+
+uint32_t os_wrapper_thread_wait_flag(uint32_t flags, uint32_t timeout)
+{
+    struct posix_thread_t *thread = os_wrapper_thread_get_handle();
+    struct timespec deadline;
+    uint32_t ret = OS_WRAPPER_SUCCESS;
+
+    if (!thread) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    get_deadline(CLOCK_MONOTONIC, timeout, &deadline);
+
+    pthread_mutex_lock(&thread->lock);
+
+    /* Wait for all the flags, as osFlagsWaitAll */
+    while ((thread->flags & flags) != flags) {
+        if (!wait_cond(&thread->cond, &thread->lock, timeout, &deadline)) {
+            ret = OS_WRAPPER_ERROR;
+            break;
+        }
+    }
+
+    if (ret == OS_WRAPPER_SUCCESS) {
+        thread->flags &= ~flags;
+    }
+
+    pthread_mutex_unlock(&thread->lock);
+
+    return ret;
+}
+
+uint32_t os_wrapper_get_tick(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / NSEC_PER_MSEC);
+}
+
+void *os_wrapper_msg_queue_create(size_t msg_size, uint8_t msg_count)
+{
+    struct posix_msg_queue_t *mq;
+
+    if (!msg_size || !msg_count) {
+        return NULL;
+    }
+
+    mq = calloc(1, sizeof(*mq));
+    if (!mq) {
+        return NULL;
+    }
+
+    mq->prio = malloc(msg_count);
+    mq->msgs = malloc(msg_size * msg_count);
+    if (!mq->prio || !mq->msgs) {
+        goto free_mq;
+    }
+
+    if (pthread_mutex_init(&mq->lock, NULL) != 0) {
+        goto free_mq;
+    }
+
+    if (init_cond(&mq->not_empty) != 0) {
+        goto destroy_lock;
+    }
+
+    if (init_cond(&mq->not_full) != 0) {
+        pthread_cond_destroy(&mq->not_empty);
+        goto destroy_lock;
+    }
+
+    mq->msg_size = msg_size;
+    mq->msg_count = msg_count;
+
+    return mq;
+
+destroy_lock:
+    pthread_mutex_destroy(&mq->lock);
+free_mq:
+    free(mq->msgs);
+    free(mq->prio);
+    free(mq);
+
+    return NULL;
+}
+
+int32_t os_wrapper_msg_queue_send(void *mq_handle,
+                                  const void *msg_ptr)
+{
+    return os_wrapper_msg_queue_send_timeout(mq_handle, msg_ptr, 0, 0);
+}
+
+int32_t os_wrapper_msg_queue_send_prio(void *mq_handle,
+                                       const void *msg_ptr,
+                                       uint8_t priority)
+{
+    return os_wrapper_msg_queue_send_timeout(mq_handle, msg_ptr, priority, 0);
+}
+
+int32_t os_wrapper_msg_queue_send_timeout(void *mq_handle,
+                                          const void *msg_ptr,
+                                          uint8_t priority,
+                                          uint32_t timeout)
+{
+    struct posix_msg_queue_t *mq = mq_handle;
+    struct timespec deadline;
+    uint8_t pos;
+
+    if (!mq || !msg_ptr) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    get_deadline(CLOCK_MONOTONIC, timeout, &deadline);
+
+    pthread_mutex_lock(&mq->lock);
+
+    while (mq->nr_msgs == mq->msg_count) {
+        if (!wait_cond(&mq->not_full, &mq->lock, timeout, &deadline)) {
+            pthread_mutex_unlock(&mq->lock);
+            return OS_WRAPPER_ERROR;
+        }
+    }
+
+    /* Queue it behind the messages of the same or a higher priority */
+    pos = mq->nr_msgs;
+    while ((pos > 0) && (mq->prio[pos - 1] < priority)) {
+        pos--;
+    }
+
+    memmove(&mq->prio[pos + 1], &mq->prio[pos], mq->nr_msgs - pos);
+    memmove(&mq->msgs[(pos + 1) * mq->msg_size], &mq->msgs[pos * mq->msg_size],
+            (mq->nr_msgs - pos) * mq->msg_size);
+
+    mq->prio[pos] = priority;
+    memcpy(&mq->msgs[pos * mq->msg_size], msg_ptr, mq->msg_size);
+    mq->nr_msgs++;
+
+    pthread_cond_signal(&mq->not_empty);
+    pthread_mutex_unlock(&mq->lock);
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+int32_t os_wrapper_msg_queue_receive(void *mq_handle,
+                                     void *msg_ptr)
+{
+    return os_wrapper_msg_queue_receive_timeout(mq_handle, msg_ptr,
+                                                OS_WRAPPER_WAIT_FOREVER);
+}
+
+int32_t os_wrapper_msg_queue_receive_timeout(void *mq_handle,
+                                             void *msg_ptr,
+                                             uint32_t timeout)
+{
+    struct posix_msg_queue_t *mq = mq_handle;
+    struct timespec deadline;
+
+    if (!mq || !msg_ptr) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    get_deadline(CLOCK_MONOTONIC, timeout, &deadline);
+
+    pthread_mutex_lock(&mq->lock);
+
+    while (!mq->nr_msgs) {
+        if (!wait_cond(&mq->not_empty, &mq->lock, timeout, &deadline)) {
+            pthread_mutex_unlock(&mq->lock);
+            return OS_WRAPPER_ERROR;
+        }
+    }
+
+    memcpy(msg_ptr, mq->msgs, mq->msg_size);
+
+    mq->nr_msgs--;
+    memmove(mq->prio, &mq->prio[1], mq->nr_msgs);
+    memmove(mq->msgs, &mq->msgs[mq->msg_size], mq->nr_msgs * mq->msg_size);
+
+    pthread_cond_signal(&mq->not_full);
+    pthread_mutex_unlock(&mq->lock);
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+int32_t os_wrapper_msg_queue_delete(void *mq_handle)
+{
+    struct posix_msg_queue_t *mq = mq_handle;
+
+    if (!mq) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    pthread_cond_destroy(&mq->not_full);
+    pthread_cond_destroy(&mq->not_empty);
+    pthread_mutex_destroy(&mq->lock);
+    free(mq->msgs);
+    free(mq->prio);
+    free(mq);
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+int32_t os_wrapper_delay(uint32_t ticks)
+{
+    struct timespec req = {
+        .tv_sec = ticks / 1000,
+        .tv_nsec = (long)(ticks % 1000) * NSEC_PER_MSEC
+    };
+
+    while (nanosleep(&req, &req) != 0) {
+        if (errno != EINTR) {
+            return OS_WRAPPER_ERROR;
+        }
+    }
+
+    return OS_WRAPPER_SUCCESS;
+}
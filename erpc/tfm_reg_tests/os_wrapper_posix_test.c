@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Smoke test of the OS wrapper on POSIX threads: threads and their flags,
+ * semaphores, mutexes, message queues and thread pools, run on the host with
+ * ctest.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "thread.h"
+#include "os_wrapper/mutex.h"
+#include "semaphore.h"
+#include "delay.h"
+#include "msg_queue.h"
+#include "thread_pool.h"
+#include "tick.h"
+
+#define TEST_PRIORITY               24U
+#define TEST_FLAG_START             0x1U
+#define TEST_FLAG_DONE              0x2U
+#define TEST_FLAG_LATE              0x4U
+#define TEST_NR_THREADS             4
+#define TEST_NR_INCREMENTS          10000
+#define TEST_TIMEOUT                50U
+#define TEST_NR_JOBS                32
+
+struct test_thread_arg_t {
+    void *parent;
+    void *mutex;
+    void *sema;
+    uint32_t *counter;
+};
+
+#define TEST_CHECK(cond, msg)                                       \
+    do {                                                            \
+        if (!(cond)) {                                              \
+            printf("FAILED: %s\r\n", (msg));                        \
+            return false;                                           \
+        }                                                           \
+    } while (0)
+
+/* Wait for the start flag, then reply to the parent and exit */
+static void flag_thread(void *argument)
+{
+    struct test_thread_arg_t *arg = argument;
+
+    if (os_wrapper_thread_wait_flag(TEST_FLAG_START,
+                                    OS_WRAPPER_WAIT_FOREVER) ==
+        OS_WRAPPER_SUCCESS) {
+        (void)os_wrapper_thread_set_flag(arg->parent, TEST_FLAG_DONE);
+    }
+}
+
+static bool test_thread_flags(void)
+{
+    struct test_thread_arg_t arg;
+    void *thread;
+
+    arg.parent = os_wrapper_thread_get_handle();
+    TEST_CHECK(arg.parent, "Main thread handle");
+
+    TEST_CHECK(os_wrapper_thread_wait_flag(TEST_FLAG_DONE, 0) ==
+               OS_WRAPPER_ERROR, "Flag wait without flag set");
+
+    thread = os_wrapper_thread_new("Thread_A", OS_WRAPPER_DEFAULT_STACK_SIZE,
+                                   flag_thread, &arg, TEST_PRIORITY);
+    TEST_CHECK(thread, "Thread creation");
+
+    TEST_CHECK(os_wrapper_thread_set_flag(thread, TEST_FLAG_START) ==
+               OS_WRAPPER_SUCCESS, "Flag set");
+    TEST_CHECK(os_wrapper_thread_wait_flag(TEST_FLAG_DONE,
+                                           OS_WRAPPER_WAIT_FOREVER) ==
+               OS_WRAPPER_SUCCESS, "Flag wait");
+
+    /* The handle of an exited thread stays valid until it is joined */
+    os_wrapper_delay(TEST_TIMEOUT);
+    TEST_CHECK(os_wrapper_thread_set_flag(thread, TEST_FLAG_LATE) ==
+               OS_WRAPPER_SUCCESS, "Flag set after the thread exited");
+    TEST_CHECK(os_wrapper_thread_join(thread) == OS_WRAPPER_SUCCESS,
+               "Thread join");
+
+    return true;
+}
+
+/* Increment the shared counter under the mutex */
+static void counter_thread(void *argument)
+{
+    struct test_thread_arg_t *arg = argument;
+    uint32_t i;
+
+    for (i = 0; i < TEST_NR_INCREMENTS; i++) {
+        (void)os_wrapper_mutex_acquire(arg->mutex, OS_WRAPPER_WAIT_FOREVER);
+        (*arg->counter)++;
+        (void)os_wrapper_mutex_release(arg->mutex);
+    }
+
+    (void)os_wrapper_semaphore_release(arg->sema);
+
+    os_wrapper_thread_exit();
+}
+
+static bool test_mutex_semaphore(void)
+{
+    struct test_thread_arg_t arg;
+    void *threads[TEST_NR_THREADS];
+    uint32_t counter = 0, start;
+    int i;
+
+    arg.counter = &counter;
+    arg.mutex = os_wrapper_mutex_create();
+    arg.sema = os_wrapper_semaphore_create(TEST_NR_THREADS, 0, NULL);
+    TEST_CHECK(arg.mutex && arg.sema, "Mutex and semaphore creation");
+
+    start = os_wrapper_get_tick();
+    TEST_CHECK(os_wrapper_semaphore_acquire(arg.sema, TEST_TIMEOUT) ==
+               OS_WRAPPER_ERROR, "Semaphore acquire timeout");
+    TEST_CHECK(os_wrapper_get_tick() - start >= TEST_TIMEOUT,
+               "Semaphore timeout duration");
+
+    for (i = 0; i < TEST_NR_THREADS; i++) {
+        threads[i] = os_wrapper_thread_new(NULL, OS_WRAPPER_DEFAULT_STACK_SIZE,
+                                           counter_thread, &arg,
+                                           TEST_PRIORITY);
+        TEST_CHECK(threads[i], "Thread creation");
+    }
+
+    for (i = 0; i < TEST_NR_THREADS; i++) {
+        TEST_CHECK(os_wrapper_semaphore_acquire(arg.sema,
+                                                OS_WRAPPER_WAIT_FOREVER) ==
+                   OS_WRAPPER_SUCCESS, "Semaphore acquire");
+    }
+
+    for (i = 0; i < TEST_NR_THREADS; i++) {
+        TEST_CHECK(os_wrapper_thread_join(threads[i]) == OS_WRAPPER_SUCCESS,
+                   "Thread join");
+    }
+
+    TEST_CHECK(counter == TEST_NR_THREADS * TEST_NR_INCREMENTS,
+               "Counter incremented under the mutex");
+
+    TEST_CHECK(os_wrapper_semaphore_release(arg.sema) == OS_WRAPPER_SUCCESS,
+               "Semaphore release");
+    TEST_CHECK(os_wrapper_semaphore_delete(arg.sema) == OS_WRAPPER_SUCCESS,
+               "Semaphore deletion");
+    TEST_CHECK(os_wrapper_mutex_delete(arg.mutex) == OS_WRAPPER_SUCCESS,
+               "Mutex deletion");
+
+    return true;
+}
+
+static bool test_msg_queue(void)
+{
+    static const uint32_t msgs[] = {1, 2, 3};
+    static const uint8_t prios[] = {0, 1, 0};
+    /* The higher priority first, FIFO within a priority */
+    static const uint32_t order[] = {2, 1, 3};
+    void *mq;
+    uint32_t msg;
+    int i;
+
+    mq = os_wrapper_msg_queue_create(sizeof(msg), 3);
+    TEST_CHECK(mq, "Message queue creation");
+
+    TEST_CHECK(os_wrapper_msg_queue_receive_timeout(mq, &msg, 0) !=
+               OS_WRAPPER_SUCCESS, "Receive from an empty queue");
+
+    for (i = 0; i < 3; i++) {
+        TEST_CHECK(os_wrapper_msg_queue_send_prio(mq, &msgs[i], prios[i]) ==
+                   OS_WRAPPER_SUCCESS, "Message send");
+    }
+
+    TEST_CHECK(os_wrapper_msg_queue_send_timeout(mq, &msgs[0], 0,
+                                                 TEST_TIMEOUT) !=
+               OS_WRAPPER_SUCCESS, "Send to a full queue");
+
+    for (i = 0; i < 3; i++) {
+        TEST_CHECK(os_wrapper_msg_queue_receive(mq, &msg) ==
+                   OS_WRAPPER_SUCCESS, "Message receive");
+        TEST_CHECK(msg == order[i], "Message order");
+    }
+
+    TEST_CHECK(os_wrapper_msg_queue_delete(mq) == OS_WRAPPER_SUCCESS,
+               "Message queue deletion");
+
+    return true;
+}
+
+/* Count a job under the mutex */
+static void pool_job(void *argument)
+{
+    struct test_thread_arg_t *arg = argument;
+
+    (void)os_wrapper_mutex_acquire(arg->mutex, OS_WRAPPER_WAIT_FOREVER);
+    (*arg->counter)++;
+    (void)os_wrapper_mutex_release(arg->mutex);
+}
+
+static bool test_thread_pool(void)
+{
+    struct os_wrapper_thread_pool_t pool;
+    struct test_thread_arg_t arg;
+    uint32_t counter = 0;
+    int i;
+
+    arg.counter = &counter;
+    arg.mutex = os_wrapper_mutex_create();
+    TEST_CHECK(arg.mutex, "Mutex creation");
+
+    TEST_CHECK(os_wrapper_thread_pool_init(&pool, "Thread_B",
+                                           OS_WRAPPER_DEFAULT_STACK_SIZE,
+                                           TEST_PRIORITY, TEST_NR_THREADS) ==
+               OS_WRAPPER_SUCCESS, "Thread pool creation");
+    TEST_CHECK(pool.nr_workers == TEST_NR_THREADS, "Thread pool workers");
+
+    for (i = 0; i < TEST_NR_JOBS; i++) {
+        TEST_CHECK(os_wrapper_thread_pool_dispatch(&pool, pool_job, &arg) ==
+                   OS_WRAPPER_SUCCESS, "Job dispatch");
+    }
+
+    /* The dispatched jobs are run before the workers exit */
+    TEST_CHECK(os_wrapper_thread_pool_delete(&pool) == OS_WRAPPER_SUCCESS,
+               "Thread pool deletion");
+    TEST_CHECK(counter == TEST_NR_JOBS, "Jobs run by the workers");
+    TEST_CHECK(os_wrapper_thread_pool_dispatch(&pool, pool_job, &arg) !=
+               OS_WRAPPER_SUCCESS, "Job dispatch after the deletion");
+
+    TEST_CHECK(os_wrapper_mutex_delete(arg.mutex) == OS_WRAPPER_SUCCESS,
+               "Mutex deletion");
+
+    return true;
+}
+
+int main(void)
+{
+    if (!test_thread_flags() || !test_mutex_semaphore() ||
+        !test_msg_queue() || !test_thread_pool()) {
+        return 1;
+    }
+
+    printf("PASSED\r\n");
+
+    return 0;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -14,8 +14,10 @@
 
 #ifdef TFM_NS_LOG
 #define LOG_MSG(...) tfm_log_printf(__VA_ARGS__)
+#define LOG_FLUSH() tfm_log_flush()
 #else
 #define LOG_MSG(...)
+#define LOG_FLUSH()
 #endif
 
 #endif /* __TFM_LOG_H__ */
@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Deferred implementation of tfm_log_printf().
+ *
+ * Instead of formatting the message, tfm_log_printf() records the address of
+ * the format string and the raw arguments in a ring buffer. tfm_log_flush()
+ * outputs the recorded messages later, out of the timing-sensitive paths:
+ * - A message without any conversion is output as is.
+ * - Other messages are output as a line made of LOG_LINE_PREFIX and the words
+ *   of the record in hex, which tests_reg/utils/decode_deferred_log.py
+ *   formats back using the strings of the ELF image.
+ *
+ * The ring buffer can be written concurrently from several threads without a
+ * lock. A writer sizes its record, reserves its words by moving the head
+ * index, formats the record straight into them, and then commits it by
+ * writing its header. The
+ * reader only consumes committed records, and clears them before handing
+ * their words back to the writers.
+ */
+
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "tfm_log_format.h"
+#include "tfm_log_raw.h"
+#include "uart_stdout.h"
+
+/* Size of the ring buffer in words, must be a power of 2 */
+#ifndef TFM_NS_LOG_DEFERRED_BUFF_WORDS
+#define TFM_NS_LOG_DEFERRED_BUFF_WORDS  1024
+#endif
+
+#if (TFM_NS_LOG_DEFERRED_BUFF_WORDS & (TFM_NS_LOG_DEFERRED_BUFF_WORDS - 1)) != 0
+#error "TFM_NS_LOG_DEFERRED_BUFF_WORDS must be a power of 2"
+#endif
+
+/* Max size of a record in words, including the header */
+#define LOG_RECORD_MAX_WORDS            64
+
+/*
+ * Record header: LOG_RECORD_COMMITTED in the top byte, LOG_RECORD_PLAIN if the
+ * format string has no conversion, and the size of the record in words.
+ * The header is followed by the address of the format string and the
+ * arguments, each padded to a whole number of words:
+ * - Integers, characters, pointers and '*' field widths take the size of the
+ *   argument on the target, least significant word first.
+ * - Strings take their bytes up to and including the NUL terminator.
+ * - Hex dumps take the number of bytes, then the bytes.
+ */
+#define LOG_RECORD_COMMITTED            0xA5000000U
+#define LOG_RECORD_TAG_MASK             0xFF000000U
+#define LOG_RECORD_PLAIN                (1U << 16)
+#define LOG_RECORD_WORDS_MASK           0x0000FFFFU
+
+/* Record with a NULL format string reporting the number of dropped records */
+#define LOG_RECORD_DROPPED              ((uintptr_t)0)
+
+#define LOG_LINE_PREFIX                 "@TL "
+#define LOG_LINE_MAX_LEN                (sizeof(LOG_LINE_PREFIX) + \
+                                         (LOG_RECORD_MAX_WORDS * 9) + 2)
+
+#define RING_MASK                       (TFM_NS_LOG_DEFERRED_BUFF_WORDS - 1)
+
+static _Atomic uint32_t log_ring[TFM_NS_LOG_DEFERRED_BUFF_WORDS];
+/* Free running word indexes of the next reservation and of the oldest record */
+static _Atomic uint32_t ring_head;
+static _Atomic uint32_t ring_tail;
+static _Atomic uint32_t dropped_records;
+static atomic_flag flush_busy = ATOMIC_FLAG_INIT;
+
+/* Only accessed by the owner of flush_busy */
+static char log_line[LOG_LINE_MAX_LEN];
+
+static const char hex_digits[] = "0123456789abcdef";
+
+/* Record being sized, or written into the ring buffer */
+struct record_t {
+    uint32_t first;                /* Ring index of the header */
+    uint32_t max_words;            /* Words available for the record */
+    bool write;                    /* false to only count the words */
+};
+
+static void record_word(const struct record_t *rec, uint32_t idx,
+                        uint32_t word)
+{
+    if (rec->write) {
+        atomic_store_explicit(&log_ring[(rec->first + idx) & RING_MASK], word,
+                              memory_order_relaxed);
+    }
+}
+
+/* Packs len bytes into the record from word idx, returns the words used */
+static uint32_t record_bytes(const struct record_t *rec, uint32_t idx,
+                             const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+    uint32_t nr_words = (uint32_t)((len + sizeof(uint32_t) - 1) /
+                                   sizeof(uint32_t));
+    uint32_t i, word;
+    size_t pos;
+
+    /* Same layout as a copy to memory on a little-endian target */
+    for (i = 0; i < nr_words; i++) {
+        word = 0;
+        for (pos = 0; pos < sizeof(uint32_t); pos++) {
+            if ((i * sizeof(uint32_t)) + pos < len) {
+                word |= (uint32_t)bytes[(i * sizeof(uint32_t)) + pos] <<
+                        (pos * 8);
+            }
+        }
+        record_word(rec, idx + i, word);
+    }
+
+    return nr_words;
+}
+
+/* Packs a string into the record from word idx, returns the words used */
+static uint32_t record_string(const struct record_t *rec, uint32_t idx,
+                              const char *str)
+{
+    size_t len = strlen(str);
+    size_t max_len = ((rec->max_words - idx) * sizeof(uint32_t)) - 1;
+    uint32_t nr_words;
+
+    if (len > max_len) {
+        len = max_len;
+    }
+
+    nr_words = record_bytes(rec, idx, str, len);
+
+    /* Always followed by at least one NUL byte */
+    if ((len % sizeof(uint32_t)) == 0) {
+        record_word(rec, idx + nr_words, 0);
+        nr_words++;
+    }
+
+    return nr_words;
+}
+
+/* Records an integer argument in as many words as it takes on the target */
+static uint32_t record_integer(const struct record_t *rec, uint32_t nr_words,
+                               uint64_t value, enum log_length_t length)
+{
+    size_t size = sizeof(int);
+
+    if (length == LOG_LENGTH_LL) {
+        size = sizeof(long long);
+    } else if (length == LOG_LENGTH_L) {
+        size = sizeof(long);
+    } else if (length == LOG_LENGTH_Z) {
+        size = sizeof(size_t);
+    }
+
+    /* Least significant word first */
+    for (; size != 0 && nr_words < rec->max_words;
+         size -= sizeof(uint32_t)) {
+        record_word(rec, nr_words++, (uint32_t)value);
+        value >>= 32;
+    }
+
+    return nr_words;
+}
+
+/*
+ * Records the format string and the arguments of a message after the header.
+ * Returns the size of the record in words, and whether it has no conversion.
+ */
+static uint32_t build_record(const struct record_t *rec, bool *plain,
+                             const char *fmt, va_list ap)
+{
+    uint32_t nr_words = 2;
+    uint32_t width_word = 0;
+    uint32_t width = 0;
+    uint32_t len;
+    struct format_spec_t spec;
+    const uint8_t *data;
+
+    record_word(rec, 1, (uint32_t)(uintptr_t)fmt);
+    *plain = true;
+
+    while (*fmt) {
+        if (*fmt++ != '%') {
+            continue;
+        }
+
+        *plain = false;
+
+        /* Consumes the arguments the same way as the raw formatter */
+        fmt = tfm_log_parse_spec(fmt, &spec);
+        if (spec.width_arg) {
+            width_word = nr_words;
+            width = (uint32_t)va_arg(ap, int);
+            nr_words = record_integer(rec, nr_words, width, LOG_LENGTH_NONE);
+        }
+
+        switch (*fmt) {
+        case 'd':
+        case 'i':
+            nr_words = record_integer(rec, nr_words,
+                                      (uint64_t)LOG_SIGNED_ARG(ap, spec.length),
+                                      spec.length);
+            break;
+        case 'u':
+        case 'x':
+        case 'X':
+            nr_words = record_integer(rec, nr_words,
+                                      LOG_UNSIGNED_ARG(ap, spec.length),
+                                      spec.length);
+            break;
+        case 'c':
+            nr_words = record_integer(rec, nr_words,
+                                      (uint64_t)va_arg(ap, int),
+                                      LOG_LENGTH_NONE);
+            break;
+        case 'p':
+            data = va_arg(ap, const uint8_t *);
+            if (*(fmt + 1) != 'h') {
+                nr_words = record_integer(rec, nr_words,
+                                          (uint64_t)(uintptr_t)data,
+                                          LOG_LENGTH_NONE);
+                break;
+            }
+
+            /* Hex dump, the bytes are recorded after their number */
+            fmt++;
+            if (*(fmt + 1) == 'C' || *(fmt + 1) == 'D' || *(fmt + 1) == 'N') {
+                fmt++;
+            }
+            if (!spec.width_arg) {
+                width_word = nr_words;
+                width = spec.width;
+                nr_words = record_integer(rec, nr_words, width,
+                                          LOG_LENGTH_NONE);
+            }
+            if (width_word >= nr_words) {
+                break;
+            }
+            len = width;
+            if (len > (rec->max_words - nr_words) * sizeof(uint32_t)) {
+                len = (rec->max_words - nr_words) * sizeof(uint32_t);
+                record_word(rec, width_word, len);
+            }
+            nr_words += record_bytes(rec, nr_words, data, len);
+            break;
+        case 's':
+            if (nr_words < rec->max_words) {
+                nr_words += record_string(rec, nr_words,
+                                          va_arg(ap, const char *));
+            } else {
+                (void)va_arg(ap, const char *);
+            }
+            break;
+        default:
+            /* '%%' or an unsupported tag, nothing to record */
+            break;
+        }
+
+        if (*fmt) {
+            fmt++;
+        }
+    }
+
+    return nr_words;
+}
+
+/* Reserves nr_words in the ring buffer, returns false if they do not fit */
+static bool reserve_record(uint32_t nr_words, uint32_t *first)
+{
+    uint32_t head, tail;
+
+    head = atomic_load_explicit(&ring_head, memory_order_relaxed);
+    do {
+        tail = atomic_load_explicit(&ring_tail, memory_order_acquire);
+        if ((head - tail) + nr_words > TFM_NS_LOG_DEFERRED_BUFF_WORDS) {
+            return false;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&ring_head, &head,
+                                                    head + nr_words,
+                                                    memory_order_relaxed,
+                                                    memory_order_relaxed));
+
+    *first = head;
+
+    return true;
+}
+
+/* Appends a word in hex and a separator to log_line */
+static size_t append_word(size_t pos, uint32_t word, char sep)
+{
+    int shift;
+
+    for (shift = 28; shift >= 0; shift -= 4) {
+        log_line[pos++] = hex_digits[(word >> shift) & 0xF];
+    }
+    log_line[pos++] = sep;
+
+    return pos;
+}
+
+/* Outputs the record at ring index first, which is not freed yet */
+static void output_record_line(uint32_t first, uint32_t nr_words)
+{
+    size_t pos = sizeof(LOG_LINE_PREFIX) - 1;
+    uint32_t i, word;
+
+    memcpy(log_line, LOG_LINE_PREFIX, pos);
+
+    /* The header is not output, the line gives the size of the record */
+    for (i = 1; i < nr_words; i++) {
+        word = atomic_load_explicit(&log_ring[(first + i) & RING_MASK],
+                                    memory_order_relaxed);
+        pos = append_word(pos, word, (i + 1 < nr_words) ? ' ' : '\r');
+    }
+    log_line[pos++] = '\n';
+
+    stdio_output_string(log_line, pos);
+}
+
+static void output_dropped_records(void)
+{
+    uint32_t dropped;
+    size_t pos = sizeof(LOG_LINE_PREFIX) - 1;
+
+    dropped = atomic_exchange_explicit(&dropped_records, 0,
+                                       memory_order_relaxed);
+    if (dropped == 0) {
+        return;
+    }
+
+    memcpy(log_line, LOG_LINE_PREFIX, pos);
+    pos = append_word(pos, (uint32_t)LOG_RECORD_DROPPED, ' ');
+    pos = append_word(pos, dropped, '\r');
+    log_line[pos++] = '\n';
+
+    stdio_output_string(log_line, pos);
+}
+
+void tfm_log_flush(void)
+{
+    uint32_t tail, header, nr_words, i;
+    const char *fmt;
+
+    /* Another thread is outputting the records */
+    if (atomic_flag_test_and_set_explicit(&flush_busy, memory_order_acquire)) {
+        return;
+    }
+
+    tail = atomic_load_explicit(&ring_tail, memory_order_relaxed);
+    while (tail != atomic_load_explicit(&ring_head, memory_order_relaxed)) {
+        header = atomic_load_explicit(&log_ring[tail & RING_MASK],
+                                      memory_order_acquire);
+        if ((header & LOG_RECORD_TAG_MASK) != LOG_RECORD_COMMITTED) {
+            /* The writer of the oldest record has not finished yet */
+            break;
+        }
+
+        /* The record is output from the ring, before it is freed */
+        nr_words = header & LOG_RECORD_WORDS_MASK;
+        if ((header & LOG_RECORD_PLAIN) != 0) {
+            fmt = (const char *)(uintptr_t)atomic_load_explicit(
+                                    &log_ring[(tail + 1) & RING_MASK],
+                                    memory_order_relaxed);
+            stdio_output_string(fmt, strlen(fmt));
+        } else {
+            output_record_line(tail, nr_words);
+        }
+
+        /*
+         * Frees the record. The words are cleared so that none of them can be
+         * mistaken for the header of a record not committed yet.
+         */
+        for (i = 0; i < nr_words; i++) {
+            atomic_store_explicit(&log_ring[(tail + i) & RING_MASK], 0,
+                                  memory_order_relaxed);
+        }
+        tail += nr_words;
+        atomic_store_explicit(&ring_tail, tail, memory_order_release);
+    }
+
+    output_dropped_records();
+
+    atomic_flag_clear_explicit(&flush_busy, memory_order_release);
+}
+
+int tfm_log_printf(const char *fmt, ...)
+{
+    struct record_t rec = {
+        .first = 0,
+        .max_words = LOG_RECORD_MAX_WORDS,
+        .write = false,
+    };
+    uint32_t nr_words;
+    bool plain;
+    va_list ap;
+
+    /* Sizes the record first, it is then formatted straight into the ring */
+    va_start(ap, fmt);
+    nr_words = build_record(&rec, &plain, fmt, ap);
+    va_end(ap);
+
+    if (!reserve_record(nr_words, &rec.first)) {
+        /* Makes room by outputting the records, unless already in progress */
+        tfm_log_flush();
+        if (!reserve_record(nr_words, &rec.first)) {
+            atomic_fetch_add_explicit(&dropped_records, 1,
+                                      memory_order_relaxed);
+            return 0;
+        }
+    }
+
+    /* A string argument changed in between is cut to the reserved size */
+    rec.max_words = nr_words;
+    rec.write = true;
+    va_start(ap, fmt);
+    (void)build_record(&rec, &plain, fmt, ap);
+    va_end(ap);
+
+    /* Commits the record */
+    atomic_store_explicit(&log_ring[rec.first & RING_MASK],
+                          LOG_RECORD_COMMITTED |
+                          (plain ? LOG_RECORD_PLAIN : 0) | nr_words,
+                          memory_order_release);
+
+    return (int)(nr_words * sizeof(uint32_t));
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TFM_LOG_FORMAT_H__
+#define __TFM_LOG_FORMAT_H__
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Conversion specifications of tfm_log_printf(), shared by the formatter and
+ * the deferred logger so that both consume the arguments the same way.
+ */
+
+enum log_length_t {
+    LOG_LENGTH_NONE,               /* int */
+    LOG_LENGTH_L,                  /* 'l': long */
+    LOG_LENGTH_LL,                 /* 'll': long long */
+    LOG_LENGTH_Z,                  /* 'z': size_t */
+};
+
+/* Flags, field width and length modifier of a conversion */
+struct format_spec_t {
+    bool left;                     /* '-': pad on the right */
+    bool zero;                     /* '0': pad numbers with zeros */
+    bool width_arg;                /* '*': width given as an argument */
+    uint32_t width;                /* Minimum field width */
+    enum log_length_t length;      /* Length modifier */
+};
+
+/* Fetches an integer argument of the size given by the length modifier */
+#define LOG_SIGNED_ARG(ap, length)                                      \
+    (((length) == LOG_LENGTH_LL) ? (int64_t)va_arg(ap, long long) :     \
+     ((length) == LOG_LENGTH_L) ? (int64_t)va_arg(ap, long) :           \
+     ((length) == LOG_LENGTH_Z) ? (int64_t)va_arg(ap, ptrdiff_t) :      \
+     (int64_t)va_arg(ap, int))
+
+#define LOG_UNSIGNED_ARG(ap, length)                                    \
+    (((length) == LOG_LENGTH_LL) ? (uint64_t)va_arg(ap, unsigned long long) : \
+     ((length) == LOG_LENGTH_L) ? (uint64_t)va_arg(ap, unsigned long) : \
+     ((length) == LOG_LENGTH_Z) ? (uint64_t)va_arg(ap, size_t) :        \
+     (uint64_t)va_arg(ap, unsigned int))
+
+/**
+ * \brief Parses the flags, field width and length modifier of a conversion
+ *
+ * \param[in]   fmt     Format string, just after the '%'
+ * \param[out]  spec    Parsed specification
+ *
+ * \return              Pointer to the conversion specifier character.
+ */
+static inline const char *tfm_log_parse_spec(const char *fmt,
+                                             struct format_spec_t *spec)
+{
+    spec->left = false;
+    spec->zero = false;
+    spec->width_arg = false;
+    spec->width = 0;
+    spec->length = LOG_LENGTH_NONE;
+
+    for (;; fmt++) {
+        if (*fmt == '-') {
+            spec->left = true;
+        } else if (*fmt == '0') {
+            spec->zero = true;
+        } else {
+            break;
+        }
+    }
+
+    if (*fmt == '*') {
+        spec->width_arg = true;
+        fmt++;
+    } else {
+        while (*fmt >= '0' && *fmt <= '9') {
+            spec->width = (spec->width * 10) + (uint32_t)(*fmt++ - '0');
+        }
+    }
+
+    if (*fmt == 'l') {
+        fmt++;
+        spec->length = LOG_LENGTH_L;
+        if (*fmt == 'l') {
+            fmt++;
+            spec->length = LOG_LENGTH_LL;
+        }
+    } else if (*fmt == 'z') {
+        fmt++;
+        spec->length = LOG_LENGTH_Z;
+    }
+
+    return fmt;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TFM_LOG_FORMAT_H__ */
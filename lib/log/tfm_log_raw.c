@@ -1,36 +1,107 @@
 /*
- * Copyright (c) 2019-2020, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
 #include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include "tfm_log_format.h"
+#include "tfm_log_raw.h"
 #include "uart_stdout.h"
+#include "uart_stdout_async.h"
 
-#define PRINT_BUFF_SIZE 32
-#define NUM_BUFF_SIZE 12
+/* Size of each of the two output buffers */
+#ifndef TFM_LOG_PRINT_BUFF_SIZE
+#define TFM_LOG_PRINT_BUFF_SIZE 32
+#endif
 
+#define PRINT_BUFF_SIZE TFM_LOG_PRINT_BUFF_SIZE
+/* Size of the buffer of a message printed while the output buffers are used */
+#define STACK_PRINT_BUFF_SIZE 16
+/* Digits of a 64-bit number */
+#define NUM_BUFF_SIZE 20
+
+/*
+ * A message is formatted into one buffer while the other one, filled
+ * previously, is being output. A message formatted into a single buffer
+ * outputs it synchronously.
+ */
 struct formatted_buffer_t {
     size_t pos;
-    char buf[PRINT_BUFF_SIZE];
+    size_t size;                   /* Size of each buffer */
+    uint32_t cur;                  /* Index of the buffer being filled */
+    bool busy;                     /* The other buffer is being output */
+    char *buf[2];                  /* buf[1] is NULL for a single buffer */
 };
 
+/*
+ * Output buffers, owned by one message at a time. A message printed
+ * concurrently, from another thread or an interrupt handler, is formatted
+ * into a small buffer on its own stack instead.
+ */
+static char print_buff[2][PRINT_BUFF_SIZE];
+static atomic_flag print_buff_owned = ATOMIC_FLAG_INIT;
+
 const char hex_digits_lo[] = {'0', '1', '2', '3', '4', '5', '6', '7',
                               '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
 const char hex_digits_up[] = {'0', '1', '2', '3', '4', '5', '6', '7',
                               '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
 
+static const char dec_digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+__attribute__((weak))
+int stdio_output_string_async(const char *str, uint32_t len)
+{
+    return stdio_output_string(str, len);
+}
+
+__attribute__((weak))
+void stdio_output_wait(void)
+{
+}
+
+static void _tfm_output_buffer(struct formatted_buffer_t *pb)
+{
+    if (pb->buf[1] == NULL) {
+        /* Output before the buffer is filled again */
+        stdio_output_string(pb->buf[0], pb->pos);
+        pb->pos = 0;
+        return;
+    }
+
+    /* Only one output at a time, the buffer being output is reused next */
+    if (pb->busy) {
+        stdio_output_wait();
+    }
+
+    stdio_output_string_async(pb->buf[pb->cur], pb->pos);
+    pb->busy = true;
+    pb->cur ^= 1;
+    pb->pos = 0;
+}
+
 static void _tfm_flush_formatted_buffer(struct formatted_buffer_t *pb,
                                         uint8_t data)
 {
-    pb->buf[pb->pos++] = data;
-    if (pb->pos >= PRINT_BUFF_SIZE) {
-        pb->pos = 0;
+    pb->buf[pb->cur][pb->pos++] = data;
+    if (pb->pos >= pb->size) {
         /* uart flush and print here. */
-        stdio_output_string(pb->buf, PRINT_BUFF_SIZE);
+        _tfm_output_buffer(pb);
     }
 }
 
@@ -47,48 +118,153 @@ static int _tfm_string_output(struct formatted_buffer_t *pb,
     return count;
 }
 
-static int _tfm_dec_num_output(struct formatted_buffer_t *pb,
-                               int32_t num, uint8_t sign)
+static int _tfm_chars_output(struct formatted_buffer_t *pb,
+                             const char *str, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        _tfm_flush_formatted_buffer(pb, str[i]);
+    }
+
+    return (int)len;
+}
+
+static int _tfm_fill_output(struct formatted_buffer_t *pb, uint8_t data,
+                            uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        _tfm_flush_formatted_buffer(pb, data);
+    }
+
+    return (int)len;
+}
+
+/*
+ * Outputs the prefix and the body of a conversion, padded to the field width.
+ * Zero padding goes between the prefix and the body.
+ */
+static int _tfm_field_output(struct formatted_buffer_t *pb,
+                             const struct format_spec_t *spec,
+                             const char *prefix, const char *body,
+                             size_t body_len)
 {
     int count = 0;
-    uint8_t num_buff[NUM_BUFF_SIZE] = {0};
-    uint32_t number = (uint32_t)num;
-    uint32_t k = 0;
+    size_t prefix_len = 0;
+    uint32_t pad = 0;
 
-    if (sign == 'd' && num < 0) {
-        _tfm_flush_formatted_buffer(pb, '-');
-        count++;
-        number = -num;
+    while (prefix[prefix_len]) {
+        prefix_len++;
     }
 
-    do {
-        num_buff[k++] = '0' + number % 10;
-        number /= 10;
-    } while (number);
+    if (spec->width > prefix_len + body_len) {
+        pad = spec->width - (uint32_t)(prefix_len + body_len);
+    }
 
-    while (k) {
-        _tfm_flush_formatted_buffer(pb, num_buff[--k]);
-        count++;
+    if (!spec->left && !spec->zero) {
+        count += _tfm_fill_output(pb, ' ', pad);
+    }
+    count += _tfm_chars_output(pb, prefix, prefix_len);
+    if (!spec->left && spec->zero) {
+        count += _tfm_fill_output(pb, '0', pad);
+    }
+    count += _tfm_chars_output(pb, body, body_len);
+    if (spec->left) {
+        count += _tfm_fill_output(pb, ' ', pad);
     }
 
     return count;
 }
 
-static int _tfm_hex_num_output(struct formatted_buffer_t *pb, uint32_t num,
+/*
+ * Converts num to decimal, two digits at a time, backwards from the end of the
+ * buffer. Returns the first digit.
+ */
+static char *_tfm_dec_convert(char *end, uint64_t num)
+{
+    char *p = end;
+    uint32_t num32;
+    uint32_t idx;
+
+    /* 64-bit divisions are slow on 32-bit cores, only use them if needed */
+    while (num > UINT32_MAX) {
+        idx = (uint32_t)(num % 100) * 2;
+        num /= 100;
+        *--p = dec_digit_pairs[idx + 1];
+        *--p = dec_digit_pairs[idx];
+    }
+
+    num32 = (uint32_t)num;
+    while (num32 >= 100) {
+        idx = (num32 % 100) * 2;
+        num32 /= 100;
+        *--p = dec_digit_pairs[idx + 1];
+        *--p = dec_digit_pairs[idx];
+    }
+
+    if (num32 >= 10) {
+        idx = num32 * 2;
+        *--p = dec_digit_pairs[idx + 1];
+        *--p = dec_digit_pairs[idx];
+    } else {
+        *--p = (char)('0' + num32);
+    }
+
+    return p;
+}
+
+static int _tfm_dec_num_output(struct formatted_buffer_t *pb,
+                               const struct format_spec_t *spec,
+                               uint64_t num, bool negative)
+{
+    char num_buff[NUM_BUFF_SIZE];
+    char *end = num_buff + NUM_BUFF_SIZE;
+    char *p;
+
+    if (negative) {
+        num = (uint64_t)0 - num;
+    }
+
+    p = _tfm_dec_convert(end, num);
+
+    return _tfm_field_output(pb, spec, negative ? "-" : "", p,
+                             (size_t)(end - p));
+}
+
+static int _tfm_hex_num_output(struct formatted_buffer_t *pb,
+                               const struct format_spec_t *spec,
+                               const char *prefix, uint64_t num,
                                const char *hex_digits)
 {
-    int count = 0;
-    uint8_t num_buff[NUM_BUFF_SIZE] = {0};
-    uint32_t k = 0;
+    char num_buff[NUM_BUFF_SIZE];
+    char *end = num_buff + NUM_BUFF_SIZE;
+    char *p = end;
 
     do {
-        num_buff[k++] = hex_digits[num & 0x0f];
+        *--p = hex_digits[num & 0x0f];
         num >>= 4;
     } while (num);
 
-    while (k) {
-        _tfm_flush_formatted_buffer(pb, num_buff[--k]);
-        count++;
+    return _tfm_field_output(pb, spec, prefix, p, (size_t)(end - p));
+}
+
+/* Outputs len bytes in hex, separated by sep unless it is '\0' */
+static int _tfm_hex_dump_output(struct formatted_buffer_t *pb,
+                                const uint8_t *data, uint32_t len, char sep)
+{
+    int count = 0;
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        if (i != 0 && sep != '\0') {
+            _tfm_flush_formatted_buffer(pb, sep);
+            count++;
+        }
+        _tfm_flush_formatted_buffer(pb, hex_digits_lo[data[i] >> 4]);
+        _tfm_flush_formatted_buffer(pb, hex_digits_lo[data[i] & 0x0f]);
+        count += 2;
     }
 
     return count;
@@ -98,41 +274,101 @@ static int _tfm_log_vprintf(const char *fmt, va_list ap)
 {
     int count = 0;
     struct formatted_buffer_t outputbuf;
+    char stack_buff[STACK_PRINT_BUFF_SIZE];
+    bool owner;
+    struct format_spec_t spec;
+    int64_t snum;
+    uint64_t unum;
+    const char *str;
+    const uint8_t *data;
+    size_t len;
+    int width;
+    char sep, ch;
 
     outputbuf.pos = 0;
+    outputbuf.cur = 0;
+    outputbuf.busy = false;
+
+    owner = !atomic_flag_test_and_set_explicit(&print_buff_owned,
+                                               memory_order_acquire);
+    if (owner) {
+        outputbuf.size = PRINT_BUFF_SIZE;
+        outputbuf.buf[0] = print_buff[0];
+        outputbuf.buf[1] = print_buff[1];
+    } else {
+        outputbuf.size = STACK_PRINT_BUFF_SIZE;
+        outputbuf.buf[0] = stack_buff;
+        outputbuf.buf[1] = NULL;
+    }
 
     while (*fmt) {
         if (*fmt == '%') {
-            switch (*(++fmt)) {
+            fmt = tfm_log_parse_spec(fmt + 1, &spec);
+            if (spec.width_arg) {
+                width = va_arg(ap, int);
+                if (width < 0) {
+                    spec.left = true;
+                    width = -width;
+                }
+                spec.width = (uint32_t)width;
+            }
+
+            switch (*fmt) {
             case 'd':
             case 'i':
-                count += _tfm_dec_num_output(&outputbuf,
-                                             va_arg(ap, int32_t), 'd');
+                snum = LOG_SIGNED_ARG(ap, spec.length);
+                count += _tfm_dec_num_output(&outputbuf, &spec,
+                                             (uint64_t)snum, snum < 0);
                 break;
             case 'u':
-                count += _tfm_dec_num_output(&outputbuf,
-                                             va_arg(ap, int32_t), 'u');
+                unum = LOG_UNSIGNED_ARG(ap, spec.length);
+                count += _tfm_dec_num_output(&outputbuf, &spec, unum, false);
                 break;
             case 'x':
-                count += _tfm_hex_num_output(&outputbuf, va_arg(ap, uint32_t),
+                unum = LOG_UNSIGNED_ARG(ap, spec.length);
+                count += _tfm_hex_num_output(&outputbuf, &spec, "", unum,
                                              hex_digits_lo);
                 break;
             case 'X':
-                count += _tfm_hex_num_output(&outputbuf, va_arg(ap, uint32_t),
+                unum = LOG_UNSIGNED_ARG(ap, spec.length);
+                count += _tfm_hex_num_output(&outputbuf, &spec, "", unum,
                                              hex_digits_up);
                 break;
             case 'p':
-                count += _tfm_string_output(&outputbuf, "0x");
-                count += _tfm_hex_num_output(&outputbuf, va_arg(ap, uint32_t),
+                if (*(fmt + 1) == 'h') {
+                    /* Hex dump of a buffer, the field width is its length */
+                    fmt++;
+                    sep = ' ';
+                    if (*(fmt + 1) == 'C') {
+                        sep = ':';
+                        fmt++;
+                    } else if (*(fmt + 1) == 'D') {
+                        sep = '-';
+                        fmt++;
+                    } else if (*(fmt + 1) == 'N') {
+                        sep = '\0';
+                        fmt++;
+                    }
+                    data = va_arg(ap, const uint8_t *);
+                    count += _tfm_hex_dump_output(&outputbuf, data,
+                                                  spec.width, sep);
+                    break;
+                }
+                count += _tfm_hex_num_output(&outputbuf, &spec, "0x",
+                                             (uintptr_t)va_arg(ap, void *),
                                              hex_digits_lo);
                 break;
             case 's':
-                count += _tfm_string_output(&outputbuf, va_arg(ap, char*));
+                str = va_arg(ap, char *);
+                for (len = 0; str[len] != '\0'; len++) {
+                }
+                spec.zero = false;
+                count += _tfm_field_output(&outputbuf, &spec, "", str, len);
                 break;
             case 'c':
-                _tfm_flush_formatted_buffer(&outputbuf,
-                                            (uint8_t)va_arg(ap, int32_t));
-                count++;
+                ch = (char)va_arg(ap, int);
+                spec.zero = false;
+                count += _tfm_field_output(&outputbuf, &spec, "", &ch, 1);
                 break;
             case '%':
                 _tfm_flush_formatted_buffer(&outputbuf, '%');
@@ -151,7 +387,15 @@ static int _tfm_log_vprintf(const char *fmt, va_list ap)
 
     /* End of printf, flush buf */
     if (outputbuf.pos) {
-        count += stdio_output_string(outputbuf.buf, outputbuf.pos);
+        _tfm_output_buffer(&outputbuf);
+    }
+
+    /* The buffers are released once the output is complete */
+    if (outputbuf.busy) {
+        stdio_output_wait();
+    }
+    if (owner) {
+        atomic_flag_clear_explicit(&print_buff_owned, memory_order_release);
     }
 
     return count;
@@ -168,3 +412,8 @@ int tfm_log_printf(const char *fmt, ...)
 
     return count;
 }
+
+void tfm_log_flush(void)
+{
+    /* Messages are output by tfm_log_printf() directly */
+}
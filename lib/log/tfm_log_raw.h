@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -8,6 +8,8 @@
 #ifndef __TFM_LOG_RAW_H__
 #define __TFM_LOG_RAW_H__
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -34,9 +36,28 @@ extern "C" {
  *                      %p - hex address of a pointer in lowercase
  *                      %c - character
  *                      %% - the '%' symbol
+ *                      %*ph - buffer in lowercase hex bytes separated by
+ *                             spaces, the length is given as an argument
+ *                             before the pointer. %*phC, %*phD and %*phN
+ *                             separate the bytes with ':', '-' and nothing
+ *
+ *                      A format can be preceded by the '-' (left justify) or
+ *                      '0' (pad with zeros) flag, then a minimum field width
+ *                      given as a number or as '*' (int argument), then the
+ *                      'l', 'll' or 'z' length modifier for integers.
  */
 int tfm_log_printf(const char *fmt, ...);
 
+/**
+ * \brief Outputs the log messages which have been recorded but not output yet
+ *
+ * \note                With TFM_NS_LOG_DEFERRED, \ref tfm_log_printf records
+ *                      the messages and this function outputs them. Otherwise
+ *                      the messages are output immediately and this function
+ *                      does nothing.
+ */
+void tfm_log_flush(void);
+
 #ifdef __cplusplus
 }
 #endif
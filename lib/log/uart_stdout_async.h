@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __UART_STDOUT_ASYNC_H__
+#define __UART_STDOUT_ASYNC_H__
+
+#include <stdint.h>
+#include "uart_stdout.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Starts the output of a string, as \ref stdio_output_string
+ *
+ * \param[in]   str     String to output, not NUL-terminated
+ * \param[in]   len     Length of the string
+ *
+ * \return              Number of chars accepted
+ *
+ * \note                The string must not be modified until
+ *                      \ref stdio_output_wait returns. The default weak
+ *                      implementation calls stdio_output_string and returns
+ *                      once the string has been output. Platforms can
+ *                      override it with a DMA or interrupt driven transfer,
+ *                      so that tfm_log_printf() formats the next part of a
+ *                      message during the output.
+ */
+int stdio_output_string_async(const char *str, uint32_t len);
+
+/**
+ * \brief Waits for the end of the output started by
+ *        \ref stdio_output_string_async
+ */
+void stdio_output_wait(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __UART_STDOUT_ASYNC_H__ */
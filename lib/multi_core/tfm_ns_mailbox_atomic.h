@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Lock-free bookkeeping of the NS mailbox queue slots.
+ *
+ * The empty slots bitmask and the statistics counters are only accessed by the
+ * non-secure core. They can be updated with atomic read-modify-write
+ * operations instead of disabling IRQs with tfm_ns_mailbox_os_spin_lock(), so
+ * that concurrent NS threads do not serialize on an IRQ-off critical section.
+ * The slot status shared with SPE still requires the mailbox HAL critical
+ * section.
+ *
+ * The cores without exclusive access instructions, such as Armv6-M, fall back
+ * to the spin lock.
+ */
+
+#ifndef __TFM_NS_MAILBOX_ATOMIC_H__
+#define __TFM_NS_MAILBOX_ATOMIC_H__
+
+#include <stdint.h>
+#include "tfm_ns_mailbox.h"
+
+#if defined(__ARM_ARCH) && !defined(__ARM_FEATURE_LDREX)
+#define NS_MAILBOX_LOCK_FREE       0
+#else
+#define NS_MAILBOX_LOCK_FREE       1
+#include <stdatomic.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if NS_MAILBOX_LOCK_FREE
+#define NS_MAILBOX_ATOMIC_SLOTS(ptr)   ((_Atomic mailbox_queue_status_t *)(ptr))
+#define NS_MAILBOX_ATOMIC_COUNTER(ptr) ((_Atomic uint32_t *)(ptr))
+#endif
+
+/* Bitmask of all the slots in the NS mailbox queue */
+#define NS_MAILBOX_ALL_SLOTS \
+    ((mailbox_queue_status_t)((0x1ULL << NUM_MAILBOX_QUEUE_SLOT) - 1))
+
+/* The number of slots set in the status */
+static inline uint8_t ns_mailbox_nr_slots(mailbox_queue_status_t status)
+{
+#if defined(__GNUC__)
+    return (uint8_t)__builtin_popcount(status);
+#else
+    uint8_t nr_slots = 0;
+
+    while (status) {
+        status &= status - 1;
+        nr_slots++;
+    }
+
+    return nr_slots;
+#endif
+}
+
+/* The index of the lowest slot set in a non-zero status */
+static inline uint8_t ns_mailbox_slot_idx(mailbox_queue_status_t status)
+{
+#if defined(__GNUC__)
+    return (uint8_t)__builtin_ctz(status);
+#else
+    uint8_t idx = 0;
+
+    while (!(status & 0x1UL)) {
+        status >>= 1;
+        idx++;
+    }
+
+    return idx;
+#endif
+}
+
+/* Select the lowest nr_slots slots set in the status. 0 if not enough. */
+static inline mailbox_queue_status_t
+ns_mailbox_lowest_slots(mailbox_queue_status_t status, uint8_t nr_slots)
+{
+    mailbox_queue_status_t selected = 0, lowest;
+
+    while (nr_slots--) {
+        if (!status) {
+            return 0;
+        }
+
+        lowest = status & (~status + 1);
+        selected |= lowest;
+        status &= ~lowest;
+    }
+
+    return selected;
+}
+
+/**
+ * \brief Claim empty slots among candidate slots.
+ *
+ * \param[in,out] empty_slots   Bitmask of the empty slots.
+ * \param[in] candidates        Bitmask of the slots which may be claimed.
+ * \param[in] nr_slots          The number of slots to claim.
+ *
+ * \return The bitmask of the claimed slots, or 0 if there are not enough
+ *         empty candidate slots. No slot is claimed in that case.
+ */
+static inline mailbox_queue_status_t
+tfm_ns_mailbox_claim_slots_in(mailbox_queue_status_t *empty_slots,
+                              mailbox_queue_status_t candidates,
+                              uint8_t nr_slots)
+{
+    mailbox_queue_status_t status, claimed;
+
+#if NS_MAILBOX_LOCK_FREE
+    status = atomic_load_explicit(NS_MAILBOX_ATOMIC_SLOTS(empty_slots),
+                                  memory_order_relaxed);
+    do {
+        claimed = ns_mailbox_lowest_slots(status & candidates, nr_slots);
+        if (!claimed) {
+            return 0;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(
+                                         NS_MAILBOX_ATOMIC_SLOTS(empty_slots),
+                                         &status, status & ~claimed,
+                                         memory_order_acquire,
+                                         memory_order_relaxed));
+#else
+    tfm_ns_mailbox_os_spin_lock();
+    status = *empty_slots;
+    claimed = ns_mailbox_lowest_slots(status & candidates, nr_slots);
+    *empty_slots = status & ~claimed;
+    tfm_ns_mailbox_os_spin_unlock();
+#endif
+
+    return claimed;
+}
+
+/**
+ * \brief Claim empty slots in the NS mailbox queue.
+ *
+ * \param[in,out] empty_slots   Bitmask of the empty slots.
+ * \param[in] nr_slots          The number of slots to claim.
+ *
+ * \return The bitmask of the claimed slots, or 0 if there are not enough
+ *         empty slots. No slot is claimed in that case.
+ */
+static inline mailbox_queue_status_t
+tfm_ns_mailbox_claim_slots(mailbox_queue_status_t *empty_slots,
+                           uint8_t nr_slots)
+{
+    return tfm_ns_mailbox_claim_slots_in(empty_slots, NS_MAILBOX_ALL_SLOTS,
+                                         nr_slots);
+}
+
+/**
+ * \brief Release slots claimed by \ref tfm_ns_mailbox_claim_slots.
+ *
+ * \note  All the other status of the slots must be re-initialized before.
+ *
+ * \param[in,out] empty_slots   Bitmask of the empty slots.
+ * \param[in] slots             Bitmask of the slots to release.
+ */
+static inline void
+tfm_ns_mailbox_release_slots(mailbox_queue_status_t *empty_slots,
+                             mailbox_queue_status_t slots)
+{
+#if NS_MAILBOX_LOCK_FREE
+    (void)atomic_fetch_or_explicit(NS_MAILBOX_ATOMIC_SLOTS(empty_slots),
+                                   slots, memory_order_release);
+#else
+    tfm_ns_mailbox_os_spin_lock();
+    *empty_slots |= slots;
+    tfm_ns_mailbox_os_spin_unlock();
+#endif
+}
+
+/**
+ * \brief Clear slots in a bitmask.
+ *
+ * \param[in,out] status        The bitmask.
+ * \param[in] slots             Bitmask of the slots to clear.
+ */
+static inline void
+tfm_ns_mailbox_clear_slots(mailbox_queue_status_t *status,
+                           mailbox_queue_status_t slots)
+{
+#if NS_MAILBOX_LOCK_FREE
+    (void)atomic_fetch_and_explicit(NS_MAILBOX_ATOMIC_SLOTS(status), ~slots,
+                                    memory_order_relaxed);
+#else
+    tfm_ns_mailbox_os_spin_lock();
+    *status &= ~slots;
+    tfm_ns_mailbox_os_spin_unlock();
+#endif
+}
+
+/**
+ * \brief Read a snapshot of the empty slots.
+ *
+ * \param[in] empty_slots       Bitmask of the empty slots.
+ *
+ * \return The bitmask of the empty slots.
+ */
+static inline mailbox_queue_status_t
+tfm_ns_mailbox_read_slots(mailbox_queue_status_t *empty_slots)
+{
+#if NS_MAILBOX_LOCK_FREE
+    return atomic_load_explicit(NS_MAILBOX_ATOMIC_SLOTS(empty_slots),
+                                memory_order_relaxed);
+#else
+    mailbox_queue_status_t status;
+
+    tfm_ns_mailbox_os_spin_lock();
+    status = *empty_slots;
+    tfm_ns_mailbox_os_spin_unlock();
+
+    return status;
+#endif
+}
+
+/**
+ * \brief Atomically add a value to a statistics counter.
+ *
+ * \param[in,out] counter       The counter.
+ * \param[in] val               The value to add.
+ */
+static inline void tfm_ns_mailbox_counter_add(uint32_t *counter, uint32_t val)
+{
+#if NS_MAILBOX_LOCK_FREE
+    (void)atomic_fetch_add_explicit(NS_MAILBOX_ATOMIC_COUNTER(counter), val,
+                                    memory_order_relaxed);
+#else
+    tfm_ns_mailbox_os_spin_lock();
+    *counter += val;
+    tfm_ns_mailbox_os_spin_unlock();
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TFM_NS_MAILBOX_ATOMIC_H__ */
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "os_wrapper/semaphore.h"
+#include "tfm_ns_mailbox.h"
+#include "tfm_ns_mailbox_atomic.h"
+#include "tfm_ns_mailbox_batch.h"
+
+static struct ns_mailbox_queue_t *batch_queue_ptr = NULL;
+
+/*
+ * Serialize the batches while they reserve their slots. Otherwise two batches
+ * could each hold a part of the slots and wait for each other forever.
+ */
+static void *batch_lock_handle = NULL;
+
+static void release_reserved_slots(uint8_t nr_slots)
+{
+    while (nr_slots--) {
+        (void)tfm_ns_mailbox_os_lock_release();
+    }
+}
+
+/*
+ * Each slot taken by the single PSA client calls holds a token of the NS
+ * mailbox lock. Holding one token per request guarantees that enough slots
+ * are empty once the batch claims them.
+ */
+static int32_t reserve_slots(uint8_t nr_slots)
+{
+    uint8_t nr_reserved;
+    int32_t ret = MAILBOX_SUCCESS;
+
+    if (os_wrapper_semaphore_acquire(batch_lock_handle,
+                                     OS_WRAPPER_WAIT_FOREVER) !=
+        OS_WRAPPER_SUCCESS) {
+        return MAILBOX_GENERIC_ERROR;
+    }
+
+    for (nr_reserved = 0; nr_reserved < nr_slots; nr_reserved++) {
+        if (tfm_ns_mailbox_os_lock_acquire() != MAILBOX_SUCCESS) {
+            release_reserved_slots(nr_reserved);
+            ret = MAILBOX_QUEUE_FULL;
+            break;
+        }
+    }
+
+    (void)os_wrapper_semaphore_release(batch_lock_handle);
+
+    return ret;
+}
+
+static mailbox_queue_status_t
+mailbox_tx_batch_req(const struct ns_mailbox_batch_req_t *reqs, uint8_t nr_reqs,
+                     uint8_t *slot_idx)
+{
+    mailbox_queue_status_t batch_status, status;
+    struct mailbox_msg_t *msg_ptr;
+    const void *task_handle;
+    uint8_t i, idx;
+
+    /*
+     * The reserved tokens guarantee enough empty slots. Claim them without
+     * disabling IRQs, as the empty slots are only accessed by NSPE.
+     */
+    batch_status = tfm_ns_mailbox_claim_slots(&batch_queue_ptr->empty_slots,
+                                              nr_reqs);
+    if (!batch_status) {
+        return 0;
+    }
+
+#ifdef TFM_MULTI_CORE_TEST
+    for (i = 0; i < nr_reqs; i++) {
+        tfm_ns_mailbox_tx_stats_update();
+    }
+#endif
+
+    /* All the slots are owned by the current task */
+    task_handle = tfm_ns_mailbox_os_get_task_handle();
+
+    for (i = 0, status = batch_status; i < nr_reqs; i++) {
+        idx = ns_mailbox_slot_idx(status);
+        status &= status - 1;
+
+        msg_ptr = &batch_queue_ptr->queue[idx].msg;
+        msg_ptr->call_type = reqs[i].call_type;
+        memcpy(&msg_ptr->params, reqs[i].params, sizeof(msg_ptr->params));
+        msg_ptr->client_id = reqs[i].client_id;
+
+        batch_queue_ptr->queue[idx].reply.owner = task_handle;
+
+        slot_idx[i] = idx;
+    }
+
+    /* The pending slots are shared with SPE */
+    tfm_ns_mailbox_hal_enter_critical();
+    batch_queue_ptr->pend_slots |= batch_status;
+    tfm_ns_mailbox_hal_exit_critical();
+
+    /* A single notification for the whole batch */
+    tfm_ns_mailbox_hal_notify_peer();
+
+    return batch_status;
+}
+
+/*
+ * Collect the replies which have arrived. Return the slots still waiting for
+ * a reply.
+ */
+static mailbox_queue_status_t
+mailbox_rx_batch_reply(mailbox_queue_status_t wait_status)
+{
+    mailbox_queue_status_t status, woken_status = 0;
+    struct mailbox_reply_t *reply_ptr;
+    uint8_t idx;
+
+    tfm_ns_mailbox_hal_enter_critical();
+
+    for (status = wait_status; status; status &= status - 1) {
+        idx = ns_mailbox_slot_idx(status);
+
+        reply_ptr = &batch_queue_ptr->queue[idx].reply;
+        if (reply_ptr->is_woken) {
+            reply_ptr->is_woken = false;
+            woken_status |= (mailbox_queue_status_t)(0x1UL << idx);
+        }
+    }
+
+    tfm_ns_mailbox_hal_exit_critical();
+
+    return wait_status & ~woken_status;
+}
+
+int32_t tfm_ns_mailbox_batch_init(struct ns_mailbox_queue_t *queue)
+{
+    if (!queue) {
+        return MAILBOX_INVAL_PARAMS;
+    }
+
+    batch_lock_handle = os_wrapper_semaphore_create(1, 1, NULL);
+    if (!batch_lock_handle) {
+        return MAILBOX_GENERIC_ERROR;
+    }
+
+    batch_queue_ptr = queue;
+
+    return MAILBOX_SUCCESS;
+}
+
+int32_t tfm_ns_mailbox_client_call_batch(struct ns_mailbox_batch_req_t *reqs,
+                                         uint8_t nr_reqs)
+{
+    mailbox_queue_status_t batch_status, wait_status;
+    uint8_t slot_idx[NUM_MAILBOX_QUEUE_SLOT];
+    uint8_t i;
+    int32_t ret;
+
+    if (!batch_queue_ptr) {
+        return MAILBOX_INIT_ERROR;
+    }
+
+    if (!reqs || !nr_reqs || (nr_reqs > NUM_MAILBOX_QUEUE_SLOT)) {
+        return MAILBOX_INVAL_PARAMS;
+    }
+
+    for (i = 0; i < nr_reqs; i++) {
+        if (!reqs[i].params) {
+            return MAILBOX_INVAL_PARAMS;
+        }
+    }
+
+    ret = reserve_slots(nr_reqs);
+    if (ret != MAILBOX_SUCCESS) {
+        return ret;
+    }
+
+    batch_status = mailbox_tx_batch_req(reqs, nr_reqs, slot_idx);
+    if (!batch_status) {
+        release_reserved_slots(nr_reqs);
+        return MAILBOX_QUEUE_FULL;
+    }
+
+    /*
+     * The thread flag is shared by all the slots of the batch. A single wake
+     * up may cover several replies, so check all the pending slots each time.
+     */
+    wait_status = batch_status;
+    while (wait_status) {
+        tfm_ns_mailbox_os_wait_reply();
+        wait_status = mailbox_rx_batch_reply(wait_status);
+    }
+
+    for (i = 0; i < nr_reqs; i++) {
+        reqs[i].reply = batch_queue_ptr->queue[slot_idx[i]].reply.return_val;
+        batch_queue_ptr->queue[slot_idx[i]].reply.owner = NULL;
+    }
+
+    /*
+     * Make sure that the empty flags are set after all the other status flags
+     * are re-initialized.
+     */
+    tfm_ns_mailbox_release_slots(&batch_queue_ptr->empty_slots, batch_status);
+
+    release_reserved_slots(nr_reqs);
+
+    return MAILBOX_SUCCESS;
+}
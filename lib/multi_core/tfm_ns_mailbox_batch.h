@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Batch submission of PSA client calls over the NS mailbox.
+ *
+ * tfm_ns_mailbox_client_call() takes a mailbox queue slot and notifies the
+ * peer core once per PSA client call. A batch posts all its requests into
+ * free slots within a single critical section and notifies the peer core only
+ * once. The replies are then collected in whatever order SPE completes them.
+ *
+ * It is only available when the NS mailbox is not run in a dedicated thread,
+ * i.e. without TFM_MULTI_CORE_NS_OS_MAILBOX_THREAD.
+ */
+
+#ifndef __TFM_NS_MAILBOX_BATCH_H__
+#define __TFM_NS_MAILBOX_BATCH_H__
+
+#include <stdint.h>
+#include "tfm_ns_mailbox.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A PSA client call request in a batch */
+struct ns_mailbox_batch_req_t {
+    uint32_t call_type;                        /* PSA client call type */
+    const struct psa_client_params_t *params;  /* PSA client call params */
+    int32_t client_id;                         /* Optional client ID of the
+                                                * non-secure caller.
+                                                */
+    int32_t reply;                             /* Return value of the PSA
+                                                * client call, set when the
+                                                * batch completes.
+                                                */
+};
+
+/**
+ * \brief Initialize the batch submission of PSA client calls.
+ *
+ * \note  It must be called after tfm_ns_mailbox_init(), with the same queue.
+ *
+ * \param[in] queue             The base address of NSPE mailbox queue.
+ *
+ * \retval MAILBOX_SUCCESS      Initialization succeeds.
+ * \retval Other return code    Initialization fails with an error code.
+ */
+int32_t tfm_ns_mailbox_batch_init(struct ns_mailbox_queue_t *queue);
+
+/**
+ * \brief Send a batch of PSA client calls to SPE via mailbox and wait for all
+ *        the results.
+ *
+ * \note  The requests occupy \p nr_reqs slots at the same time. The caller
+ *        blocks until that many slots are free.
+ *
+ * \param[in,out] reqs          The requests. The reply of each request is set
+ *                              when this function succeeds.
+ * \param[in] nr_reqs           The number of requests. It must not exceed
+ *                              NUM_MAILBOX_QUEUE_SLOT.
+ *
+ * \retval MAILBOX_SUCCESS      All the PSA client calls are completed.
+ * \retval Other return code    Operation failed with an error code. No
+ *                              request has been sent to SPE.
+ */
+int32_t tfm_ns_mailbox_client_call_batch(struct ns_mailbox_batch_req_t *reqs,
+                                         uint8_t nr_reqs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TFM_NS_MAILBOX_BATCH_H__ */
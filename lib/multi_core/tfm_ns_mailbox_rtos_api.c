@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -11,6 +11,9 @@
  * It can be replaced by RTOS specific implementation.
  */
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "cmsis_compiler.h"
 
 #ifdef TFM_MULTI_CORE_NS_OS_MAILBOX_THREAD
@@ -21,6 +24,10 @@
 #include "os_wrapper/thread.h"
 
 #include "tfm_ns_mailbox.h"
+#include "tfm_ns_mailbox_atomic.h"
+#ifdef TFM_MULTI_CORE_TEST
+#include "tfm_ns_mailbox_stats.h"
+#endif
 
 /*
  * Thread flag to manage wait/wake mechanism in mailbox.、
@@ -30,6 +37,184 @@
  */
 #define MAILBOX_THREAD_FLAG            0x5FCA0000
 
+/*
+ * Adaptive wait for the reply: spin on a wake-up flag in memory for a window
+ * of polls before blocking on the thread flag. A reply arriving within the
+ * window saves the RTOS context switches, and the polls do not enter the
+ * kernel. The window follows twice the number of polls the recent replies
+ * took, and is halved each time a reply did not arrive within it so that slow
+ * services do not waste CPU time spinning. The maximum window is probed
+ * periodically so that the window can grow back when the replies get faster
+ * again.
+ * A maximum window of 0 always blocks.
+ */
+#ifndef MAILBOX_WAIT_SPIN_MAX
+#define MAILBOX_WAIT_SPIN_MAX          1024U
+#endif
+#define MAILBOX_WAIT_SPIN_MIN          8U
+#define MAILBOX_WAIT_PROBE_PERIOD      16U
+
+#if (MAILBOX_WAIT_SPIN_MAX > 0)
+/*
+ * A task spinning for its reply. At most one task per queue slot waits for a
+ * reply. The entries are claimed in the bitmask of free waiters.
+ */
+struct mailbox_waiter_t {
+    const void *owner;              /* Handle of the waiting task */
+    volatile bool is_woken;         /* Set by the mailbox interrupt handler */
+};
+
+static struct mailbox_waiter_t waiters[NUM_MAILBOX_QUEUE_SLOT];
+static mailbox_queue_status_t free_waiters = NS_MAILBOX_ALL_SLOTS;
+static mailbox_queue_status_t spin_waiters;
+
+static uint32_t wait_spin_window = MAILBOX_WAIT_SPIN_MAX;
+static uint32_t wait_nr_calls;
+static bool wait_spin_enabled = true;
+
+static uint32_t wait_spin_window_next(uint32_t window, uint32_t nr_polls,
+                                      bool is_hit)
+{
+    if (is_hit) {
+        window = (window * 3 + nr_polls * 2) / 4;
+    } else {
+        window /= 2;
+    }
+
+    if (window < MAILBOX_WAIT_SPIN_MIN) {
+        window = MAILBOX_WAIT_SPIN_MIN;
+    } else if (window > MAILBOX_WAIT_SPIN_MAX) {
+        window = MAILBOX_WAIT_SPIN_MAX;
+    }
+
+    return window;
+}
+
+static void wait_spin_window_update(uint32_t nr_polls, bool is_hit)
+{
+#if NS_MAILBOX_LOCK_FREE
+    uint32_t window;
+
+    window = atomic_load_explicit(NS_MAILBOX_ATOMIC_COUNTER(&wait_spin_window),
+                                  memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(
+                            NS_MAILBOX_ATOMIC_COUNTER(&wait_spin_window),
+                            &window,
+                            wait_spin_window_next(window, nr_polls, is_hit),
+                            memory_order_relaxed, memory_order_relaxed)) {
+    }
+#else
+    tfm_ns_mailbox_os_spin_lock();
+    wait_spin_window = wait_spin_window_next(wait_spin_window, nr_polls,
+                                             is_hit);
+    tfm_ns_mailbox_os_spin_unlock();
+#endif
+}
+
+/* The window of the current wait */
+static uint32_t wait_spin_window_get(void)
+{
+    uint32_t nr_calls, window;
+
+#if NS_MAILBOX_LOCK_FREE
+    nr_calls = atomic_fetch_add_explicit(
+                                NS_MAILBOX_ATOMIC_COUNTER(&wait_nr_calls), 1,
+                                memory_order_relaxed) + 1;
+    window = atomic_load_explicit(NS_MAILBOX_ATOMIC_COUNTER(&wait_spin_window),
+                                  memory_order_relaxed);
+#else
+    tfm_ns_mailbox_os_spin_lock();
+    nr_calls = ++wait_nr_calls;
+    window = wait_spin_window;
+    tfm_ns_mailbox_os_spin_unlock();
+#endif
+
+    if ((nr_calls % MAILBOX_WAIT_PROBE_PERIOD) == 0) {
+        window = MAILBOX_WAIT_SPIN_MAX;
+    }
+
+    return window;
+}
+
+/* Spin for the reply. Return true if it arrived within the window. */
+static bool wait_reply_spin(void)
+{
+    struct mailbox_waiter_t *waiter;
+    mailbox_queue_status_t entry;
+    uint32_t nr_polls, window;
+    bool is_hit = false;
+
+    if (!wait_spin_enabled) {
+        return false;
+    }
+
+    entry = tfm_ns_mailbox_claim_slots(&free_waiters, 1);
+    if (!entry) {
+        return false;
+    }
+
+    waiter = &waiters[ns_mailbox_slot_idx(entry)];
+    waiter->owner = tfm_ns_mailbox_os_get_task_handle();
+    waiter->is_woken = false;
+
+    /* Published to the interrupt handler */
+    tfm_ns_mailbox_release_slots(&spin_waiters, entry);
+
+    /* The reply may have arrived before the waiter was published */
+    if (os_wrapper_thread_wait_flag(MAILBOX_THREAD_FLAG, 0) ==
+        OS_WRAPPER_SUCCESS) {
+        is_hit = true;
+        nr_polls = 1;
+    } else {
+        window = wait_spin_window_get();
+
+        for (nr_polls = 1; nr_polls <= window; nr_polls++) {
+            if (waiter->is_woken) {
+                /* Consume the thread flag set along with the wake-up flag */
+                (void)os_wrapper_thread_wait_flag(MAILBOX_THREAD_FLAG, 0);
+                is_hit = true;
+                break;
+            }
+        }
+
+        wait_spin_window_update(nr_polls, is_hit);
+    }
+
+    tfm_ns_mailbox_clear_slots(&spin_waiters, entry);
+    tfm_ns_mailbox_release_slots(&free_waiters, entry);
+
+    return is_hit;
+}
+
+/* Set the wake-up flag of a spinning task */
+static void wake_spin_waiter_isr(const void *task_handle)
+{
+    mailbox_queue_status_t status;
+    uint8_t idx;
+
+    status = tfm_ns_mailbox_read_slots(&spin_waiters);
+
+    for (; status; status &= status - 1) {
+        idx = ns_mailbox_slot_idx(status);
+        if (waiters[idx].owner == task_handle) {
+            waiters[idx].is_woken = true;
+            return;
+        }
+    }
+}
+#endif
+
+#ifdef TFM_MULTI_CORE_TEST
+void tfm_ns_mailbox_test_wait_spin(bool enable)
+{
+#if (MAILBOX_WAIT_SPIN_MAX > 0)
+    wait_spin_enabled = enable;
+#else
+    (void)enable;
+#endif
+}
+#endif
+
 #ifndef TFM_MULTI_CORE_NS_OS_MAILBOX_THREAD
 #define MAX_SEMAPHORE_COUNT            NUM_MAILBOX_QUEUE_SLOT
 
@@ -43,11 +228,25 @@ const void *tfm_ns_mailbox_os_get_task_handle(void)
 
 void tfm_ns_mailbox_os_wait_reply(void)
 {
+#if (MAILBOX_WAIT_SPIN_MAX > 0)
+    if (wait_reply_spin()) {
+        return;
+    }
+#endif
+
     os_wrapper_thread_wait_flag(MAILBOX_THREAD_FLAG, OS_WRAPPER_WAIT_FOREVER);
 }
 
 void tfm_ns_mailbox_os_wake_task_isr(const void *task_handle)
 {
+#ifdef TFM_MULTI_CORE_TEST
+    tfm_ns_mailbox_stats_reply_isr(task_handle);
+#endif
+
+#if (MAILBOX_WAIT_SPIN_MAX > 0)
+    wake_spin_waiter_isr(task_handle);
+#endif
+
     os_wrapper_thread_set_flag_isr((void *)task_handle, MAILBOX_THREAD_FLAG);
 }
 
@@ -75,6 +274,23 @@ void *tfm_ns_mailbox_os_mq_create(size_t msg_size, uint8_t msg_count)
     return os_wrapper_msg_queue_create(msg_size, msg_count);
 }
 
+/*
+ * The requests are dispatched by the mailbox thread in order of the priority
+ * of their caller, so that a high priority thread is not delayed by the
+ * requests queued by lower priority threads.
+ */
+static uint8_t mq_msg_priority(void)
+{
+    uint32_t priority;
+
+    if (os_wrapper_thread_get_priority(os_wrapper_thread_get_handle(),
+                                       &priority) != OS_WRAPPER_SUCCESS) {
+        return 0;
+    }
+
+    return (priority > UINT8_MAX) ? UINT8_MAX : (uint8_t)priority;
+}
+
 int32_t tfm_ns_mailbox_os_mq_send(void *mq_handle, const void *msg_ptr)
 {
     int32_t ret;
@@ -83,14 +299,15 @@ int32_t tfm_ns_mailbox_os_mq_send(void *mq_handle, const void *msg_ptr)
         return MAILBOX_INVAL_PARAMS;
     }
 
-    while (1) {
-        ret = os_wrapper_msg_queue_send(mq_handle, msg_ptr);
-        if (ret == OS_WRAPPER_SUCCESS) {
-            return MAILBOX_SUCCESS;
-        }
+    /* Block until the mailbox thread frees an entry of a full queue */
+    ret = os_wrapper_msg_queue_send_timeout(mq_handle, msg_ptr,
+                                            mq_msg_priority(),
+                                            OS_WRAPPER_WAIT_FOREVER);
+    if (ret != OS_WRAPPER_SUCCESS) {
+        return MAILBOX_GENERIC_ERROR;
     }
 
-    return MAILBOX_GENERIC_ERROR;
+    return MAILBOX_SUCCESS;
 }
 
 int32_t tfm_ns_mailbox_os_mq_receive(void *mq_handle, void *msg_ptr)
@@ -101,14 +318,13 @@ int32_t tfm_ns_mailbox_os_mq_receive(void *mq_handle, void *msg_ptr)
         return MAILBOX_INVAL_PARAMS;
     }
 
-    while (1) {
-        ret = os_wrapper_msg_queue_receive(mq_handle, msg_ptr);
-        if (ret == OS_WRAPPER_SUCCESS) {
-            return MAILBOX_SUCCESS;
-        }
+    ret = os_wrapper_msg_queue_receive_timeout(mq_handle, msg_ptr,
+                                               OS_WRAPPER_WAIT_FOREVER);
+    if (ret != OS_WRAPPER_SUCCESS) {
+        return MAILBOX_GENERIC_ERROR;
     }
 
-    return MAILBOX_GENERIC_ERROR;
+    return MAILBOX_SUCCESS;
 }
 #else /* TFM_MULTI_CORE_NS_OS_MAILBOX_THREAD */
 int32_t tfm_ns_mailbox_os_lock_init(void)
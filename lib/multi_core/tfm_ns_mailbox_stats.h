@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Latency and queue depth distribution of the NS mailbox PSA client calls,
+ * recorded in the multi-core tests (TFM_MULTI_CORE_TEST).
+ *
+ * The latency of a call is measured from its enqueue to the wake-up of its
+ * owner task when the reply arrives. It is recorded in a histogram of log2
+ * buckets: bucket 0 holds the latency 0 and bucket n holds the latencies in
+ * [2^(n-1), 2^n - 1]. The queue depth is the number of occupied slots when a
+ * call is enqueued, recorded with one bucket per depth.
+ */
+
+#ifndef __TFM_NS_MAILBOX_STATS_H__
+#define __TFM_NS_MAILBOX_STATS_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The number of buckets in the latency histogram */
+#define NS_MAILBOX_LATENCY_BUCKETS          33
+
+/* Percentiles of a distribution */
+struct ns_mailbox_percentile_t {
+    uint32_t nr_samples;       /* The number of recorded samples */
+    uint32_t p50;              /* The median */
+    uint32_t p99;              /* The 99th percentile */
+    uint32_t max;              /* The maximum recorded sample */
+};
+
+/**
+ * \brief Get the current time to measure the latency of PSA client calls.
+ *
+ * \note  The default weak implementation returns the RTOS tick count. The
+ *        multi-core test suite overrides it with the test framework
+ *        timestamp, as most calls complete within a tick. It is called from
+ *        both thread and interrupt contexts.
+ *
+ * \return The current time.
+ */
+uint32_t tfm_ns_mailbox_stats_get_time(void);
+
+/**
+ * \brief Record the end of a PSA client call when its owner task is woken up.
+ *
+ * \note  It is called from the mailbox interrupt handler, when the reply of
+ *        a queue slot has been marked woken. The call is matched by the slot
+ *        owned by the task, so that the calls of a batch are told apart.
+ *
+ * \param[in] task_handle       The handle of the owner task.
+ */
+void tfm_ns_mailbox_stats_reply_isr(const void *task_handle);
+
+/**
+ * \brief Get the number of replies received since the last
+ *        \ref tfm_ns_mailbox_tx_stats_reinit.
+ *
+ * \note  The replies are counted by the mailbox interrupt handler in the
+ *        order they arrive, before their owner task is woken up.
+ *
+ * \return The number of replies.
+ */
+uint32_t tfm_ns_mailbox_stats_nr_replies(void);
+
+/**
+ * \brief Get the percentiles of the PSA client call latency since the last
+ *        \ref tfm_ns_mailbox_tx_stats_reinit.
+ *
+ * \note  p50 and p99 are the upper bounds of the histogram buckets they fall
+ *        into. The maximum is exact.
+ *
+ * \param[out] res              The latency percentiles, in the time unit of
+ *                              \ref tfm_ns_mailbox_stats_get_time.
+ */
+void tfm_ns_mailbox_stats_latency(struct ns_mailbox_percentile_t *res);
+
+/**
+ * \brief Get the percentiles of the queue depth since the last
+ *        \ref tfm_ns_mailbox_tx_stats_reinit.
+ *
+ * \param[out] res              The queue depth percentiles, in slots.
+ */
+void tfm_ns_mailbox_stats_queue_depth(struct ns_mailbox_percentile_t *res);
+
+/**
+ * \brief Copy the latency histogram.
+ *
+ * \param[out] hist             The number of samples of each bucket.
+ */
+void tfm_ns_mailbox_stats_latency_hist(
+                                    uint32_t hist[NS_MAILBOX_LATENCY_BUCKETS]);
+
+/**
+ * \brief Claim an empty slot of the NS mailbox queue and release it, without
+ *        any request, to measure the cost of the slot bookkeeping when several
+ *        threads contend for the slots.
+ *
+ * \note  No PSA client call must be in progress.
+ *
+ * \param[in] lock_free         true to use \ref tfm_ns_mailbox_claim_slots and
+ *                              \ref tfm_ns_mailbox_release_slots, false to
+ *                              update the slots with IRQs disabled.
+ *
+ * \retval MAILBOX_SUCCESS        A slot has been claimed and released.
+ * \retval MAILBOX_QUEUE_FULL     All the slots are claimed by other threads.
+ * \retval MAILBOX_GENERIC_ERROR  The slot claimed is held by another thread.
+ * \retval MAILBOX_INIT_ERROR     The statistics are not initialized.
+ */
+int32_t tfm_ns_mailbox_test_cycle_slot(bool lock_free);
+
+/**
+ * \brief Enable or disable the spinning of the callers waiting for a reply,
+ *        to compare the round trip of the calls with and without it.
+ *
+ * \note  It has no effect if the spinning is not built in.
+ *
+ * \param[in] enable            false to always block for the reply.
+ */
+void tfm_ns_mailbox_test_wait_spin(bool enable);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TFM_NS_MAILBOX_STATS_H__ */
@@ -1,15 +1,162 @@
 /*
- * Copyright (c) 2020-2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
+#include "os_wrapper/tick.h"
 #include "tfm_ns_mailbox.h"
+#include "tfm_ns_mailbox_atomic.h"
+#include "tfm_ns_mailbox_stats.h"
 #include "tfm_ns_mailbox_test.h"
 
 static struct ns_mailbox_queue_t *stats_queue_ptr = NULL;
 
+/*
+ * The calls are tracked by the queue slot they are sent in. The start time of
+ * a call is indexed by its slot. The slot is cleared in stats_free_slots when
+ * the start is recorded, and set again when the reply is recorded.
+ */
+static uint32_t stats_start[NUM_MAILBOX_QUEUE_SLOT];
+static mailbox_queue_status_t stats_free_slots = NS_MAILBOX_ALL_SLOTS;
+
+/* Only updated by the mailbox interrupt handler */
+static uint32_t latency_hist[NS_MAILBOX_LATENCY_BUCKETS];
+static uint32_t latency_max;
+static volatile uint32_t stats_nr_replies;
+
+static uint32_t depth_hist[NUM_MAILBOX_QUEUE_SLOT + 1];
+
+/*
+ * Slots not held by tfm_ns_mailbox_test_cycle_slot(). A slot claimed from the
+ * queue while another thread holds it is not found here.
+ */
+static mailbox_queue_status_t cycle_free_slots = NS_MAILBOX_ALL_SLOTS;
+
+static void stats_hist_reset(void)
+{
+    uint8_t idx;
+
+    for (idx = 0; idx < NS_MAILBOX_LATENCY_BUCKETS; idx++) {
+        latency_hist[idx] = 0;
+    }
+    latency_max = 0;
+    stats_nr_replies = 0;
+
+    for (idx = 0; idx <= NUM_MAILBOX_QUEUE_SLOT; idx++) {
+        depth_hist[idx] = 0;
+    }
+
+    stats_free_slots = NS_MAILBOX_ALL_SLOTS;
+}
+
+/* Bucket n holds the latencies which need n bits */
+static uint8_t latency_bucket(uint32_t latency)
+{
+#if defined(__GNUC__)
+    return latency ? (uint8_t)(32 - __builtin_clz(latency)) : 0;
+#else
+    uint8_t bucket = 0;
+
+    while (latency) {
+        bucket++;
+        latency >>= 1;
+    }
+
+    return bucket;
+#endif
+}
+
+static uint32_t latency_bucket_bound(uint8_t bucket)
+{
+    return (uint32_t)((0x1ULL << bucket) - 1);
+}
+
+/*
+ * Called after the caller has claimed the slot of its call, before the call is
+ * sent. The call takes the lowest claimed slot which is not tracked yet. The
+ * start times of the calls claimed at the same time may be swapped between
+ * their slots, which only moves them by the time between the claims.
+ *
+ * A slot whose reply has been recorded stays claimed until its owner task runs
+ * and frees it. Its reply is marked woken until then, and it is skipped, so
+ * that it does not take the start time of the new call.
+ */
+static void stats_record_start(void)
+{
+    mailbox_queue_status_t claimed, status, slot;
+    uint8_t idx;
+
+    claimed = ~tfm_ns_mailbox_read_slots(&stats_queue_ptr->empty_slots) &
+              NS_MAILBOX_ALL_SLOTS;
+
+    for (status = claimed; status; status &= status - 1) {
+        idx = ns_mailbox_slot_idx(status);
+        if (stats_queue_ptr->queue[idx].reply.is_woken) {
+            claimed &= ~(status & (~status + 1));
+        }
+    }
+
+    slot = tfm_ns_mailbox_claim_slots_in(&stats_free_slots, claimed, 1);
+    if (!slot) {
+        return;
+    }
+
+    /* The reply cannot arrive before the call is sent after this update */
+    stats_start[ns_mailbox_slot_idx(slot)] = tfm_ns_mailbox_stats_get_time();
+}
+
+/*
+ * Fill the percentiles from a histogram. bound() gives the largest value held
+ * by a bucket, or NULL if each bucket holds a single value.
+ */
+static void stats_percentile(const uint32_t *hist, uint8_t nr_buckets,
+                             uint32_t (*bound)(uint8_t), uint32_t max,
+                             struct ns_mailbox_percentile_t *res)
+{
+    uint32_t nr_samples = 0, count = 0, rank_50, rank_99, value;
+    uint8_t idx;
+
+    res->p50 = 0;
+    res->p99 = 0;
+    res->max = max;
+
+    for (idx = 0; idx < nr_buckets; idx++) {
+        nr_samples += hist[idx];
+    }
+
+    res->nr_samples = nr_samples;
+    if (!nr_samples) {
+        return;
+    }
+
+    /* Nearest-rank percentiles */
+    rank_50 = (uint32_t)(((uint64_t)nr_samples * 50 + 99) / 100);
+    rank_99 = (uint32_t)(((uint64_t)nr_samples * 99 + 99) / 100);
+
+    for (idx = 0; idx < nr_buckets; idx++) {
+        if (!hist[idx]) {
+            continue;
+        }
+
+        value = bound ? bound(idx) : idx;
+        if (value > max) {
+            value = max;
+        }
+
+        if ((count < rank_50) && (count + hist[idx] >= rank_50)) {
+            res->p50 = value;
+        }
+        if ((count < rank_99) && (count + hist[idx] >= rank_99)) {
+            res->p99 = value;
+            break;
+        }
+
+        count += hist[idx];
+    }
+}
+
 void tfm_ns_mailbox_tx_stats_init(struct ns_mailbox_queue_t *ns_queue)
 {
     if (!ns_queue) {
@@ -18,6 +165,7 @@ void tfm_ns_mailbox_tx_stats_init(struct ns_mailbox_queue_t *ns_queue)
 
     ns_queue->nr_tx = 0;
     ns_queue->nr_used_slots = 0;
+    stats_hist_reset();
 
     stats_queue_ptr = ns_queue;
 }
@@ -30,6 +178,7 @@ int32_t tfm_ns_mailbox_tx_stats_reinit(void)
 
     stats_queue_ptr->nr_tx = 0;
     stats_queue_ptr->nr_used_slots = 0;
+    stats_hist_reset();
 
     return MAILBOX_SUCCESS;
 }
@@ -37,29 +186,191 @@ int32_t tfm_ns_mailbox_tx_stats_reinit(void)
 void tfm_ns_mailbox_tx_stats_update(void)
 {
     mailbox_queue_status_t empty_status;
-    uint8_t idx, nr_empty = 0;
+    uint8_t nr_used;
 
     if (!stats_queue_ptr) {
         return;
     }
 
-    tfm_ns_mailbox_os_spin_lock();
     /* Count the number of used slots when this tx arrives */
-    empty_status = stats_queue_ptr->empty_slots;
-    tfm_ns_mailbox_os_spin_unlock();
+    empty_status = tfm_ns_mailbox_read_slots(&stats_queue_ptr->empty_slots);
+    nr_used = NUM_MAILBOX_QUEUE_SLOT -
+              ns_mailbox_nr_slots(empty_status & NS_MAILBOX_ALL_SLOTS);
+
+    tfm_ns_mailbox_counter_add(&stats_queue_ptr->nr_used_slots, nr_used);
+    tfm_ns_mailbox_counter_add(&stats_queue_ptr->nr_tx, 1);
+    tfm_ns_mailbox_counter_add(&depth_hist[nr_used], 1);
+
+    stats_record_start();
+}
+
+__attribute__((weak))
+uint32_t tfm_ns_mailbox_stats_get_time(void)
+{
+    return os_wrapper_get_tick();
+}
+
+/*
+ * The slot of the woken call is owned by the task and has just been marked
+ * woken. The earlier calls of the same task, such as the other calls of a
+ * batch, have already been recorded and are no longer tracked.
+ */
+static mailbox_queue_status_t stats_woken_slot(const void *task_handle)
+{
+    mailbox_queue_status_t status, owned = 0;
+    struct mailbox_reply_t *reply_ptr;
+    uint8_t idx;
+
+    status = ~tfm_ns_mailbox_read_slots(&stats_free_slots) &
+             NS_MAILBOX_ALL_SLOTS;
+
+    for (; status; status &= status - 1) {
+        idx = ns_mailbox_slot_idx(status);
+        reply_ptr = &stats_queue_ptr->queue[idx].reply;
 
-    if (empty_status) {
-        for (idx = 0; idx < NUM_MAILBOX_QUEUE_SLOT; idx++) {
-            if (empty_status & (0x1UL << idx)) {
-                nr_empty++;
-            }
+        if (reply_ptr->owner != task_handle) {
+            continue;
         }
+
+        if (reply_ptr->is_woken) {
+            return status & (~status + 1);
+        }
+
+        if (!owned) {
+            owned = status & (~status + 1);
+        }
+    }
+
+    /* The woken flag may be set after the owner task is woken up */
+    return owned;
+}
+
+void tfm_ns_mailbox_stats_reply_isr(const void *task_handle)
+{
+    mailbox_queue_status_t slot;
+    uint32_t latency;
+
+    if (!stats_queue_ptr) {
+        return;
+    }
+
+    stats_nr_replies++;
+
+    slot = stats_woken_slot(task_handle);
+    if (!slot) {
+        return;
+    }
+
+    latency = tfm_ns_mailbox_stats_get_time() -
+              stats_start[ns_mailbox_slot_idx(slot)];
+
+    tfm_ns_mailbox_release_slots(&stats_free_slots, slot);
+
+    latency_hist[latency_bucket(latency)]++;
+    if (latency > latency_max) {
+        latency_max = latency;
+    }
+}
+
+uint32_t tfm_ns_mailbox_stats_nr_replies(void)
+{
+    return stats_nr_replies;
+}
+
+void tfm_ns_mailbox_stats_latency(struct ns_mailbox_percentile_t *res)
+{
+    if (!res) {
+        return;
+    }
+
+    stats_percentile(latency_hist, NS_MAILBOX_LATENCY_BUCKETS,
+                     latency_bucket_bound, latency_max, res);
+}
+
+void tfm_ns_mailbox_stats_queue_depth(struct ns_mailbox_percentile_t *res)
+{
+    uint8_t depth_max = NUM_MAILBOX_QUEUE_SLOT;
+
+    if (!res) {
+        return;
+    }
+
+    while (depth_max && !depth_hist[depth_max]) {
+        depth_max--;
     }
 
+    stats_percentile(depth_hist, NUM_MAILBOX_QUEUE_SLOT + 1, NULL, depth_max,
+                     res);
+}
+
+void tfm_ns_mailbox_stats_latency_hist(
+                                    uint32_t hist[NS_MAILBOX_LATENCY_BUCKETS])
+{
+    uint8_t idx;
+
+    if (!hist) {
+        return;
+    }
+
+    for (idx = 0; idx < NS_MAILBOX_LATENCY_BUCKETS; idx++) {
+        hist[idx] = latency_hist[idx];
+    }
+}
+
+/* Check that no other thread holds the claimed slot while it is held */
+static int32_t cycle_hold_slot(mailbox_queue_status_t claimed)
+{
+    if (!tfm_ns_mailbox_claim_slots_in(&cycle_free_slots, claimed, 1)) {
+        return MAILBOX_GENERIC_ERROR;
+    }
+
+    tfm_ns_mailbox_release_slots(&cycle_free_slots, claimed);
+
+    return MAILBOX_SUCCESS;
+}
+
+int32_t tfm_ns_mailbox_test_cycle_slot(bool lock_free)
+{
+    mailbox_queue_status_t *empty_slots, status, claimed;
+    int32_t ret;
+
+    if (!stats_queue_ptr) {
+        return MAILBOX_INIT_ERROR;
+    }
+
+    empty_slots = &stats_queue_ptr->empty_slots;
+
+    if (lock_free) {
+        claimed = tfm_ns_mailbox_claim_slots(empty_slots, 1);
+        if (!claimed) {
+            return MAILBOX_QUEUE_FULL;
+        }
+
+        ret = cycle_hold_slot(claimed);
+
+        tfm_ns_mailbox_release_slots(empty_slots, claimed);
+
+        return ret;
+    }
+
+    /* The bookkeeping before tfm_ns_mailbox_atomic.h */
     tfm_ns_mailbox_os_spin_lock();
-    stats_queue_ptr->nr_used_slots += (NUM_MAILBOX_QUEUE_SLOT - nr_empty);
-    stats_queue_ptr->nr_tx++;
+    status = *empty_slots & NS_MAILBOX_ALL_SLOTS;
+    claimed = status & (~status + 1);
+    *empty_slots &= ~claimed;
     tfm_ns_mailbox_os_spin_unlock();
+
+    if (!claimed) {
+        return MAILBOX_QUEUE_FULL;
+    }
+
+    ret = cycle_hold_slot(claimed);
+
+    tfm_ns_mailbox_os_spin_lock();
+    *empty_slots |= claimed;
+    tfm_ns_mailbox_os_spin_unlock();
+
+    return ret;
 }
 
 void tfm_ns_mailbox_stats_avg_slot(struct ns_mailbox_stats_res_t *stats_res)
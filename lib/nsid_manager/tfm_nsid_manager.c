@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -13,29 +13,90 @@
 #define THREAD_NUM_MAX          10
 #endif
 
+/*
+ * The map table is an open addressing hash table with linear probing, so that
+ * nsid_mgr_query_nsid() called on every RTOS context switch takes a constant
+ * time however many threads there are. It has a power of two size and is kept
+ * at most half full.
+ */
+#if THREAD_NUM_MAX <= 8
+#define NSID_MGR_TABLE_BITS     4
+#elif THREAD_NUM_MAX <= 16
+#define NSID_MGR_TABLE_BITS     5
+#elif THREAD_NUM_MAX <= 32
+#define NSID_MGR_TABLE_BITS     6
+#elif THREAD_NUM_MAX <= 64
+#define NSID_MGR_TABLE_BITS     7
+#elif THREAD_NUM_MAX <= 128
+#define NSID_MGR_TABLE_BITS     8
+#elif THREAD_NUM_MAX <= 255
+#define NSID_MGR_TABLE_BITS     9
+#else
+/* Thread IDs are 8-bit values and 0 is not a valid one */
+#error "THREAD_NUM_MAX must not exceed 255"
+#endif
+
+#define NSID_MGR_TABLE_SIZE     (1U << NSID_MGR_TABLE_BITS)
+
 /* Map table of token and NSIDs */
 struct nsid_token_pair {
     uint32_t token;
     int32_t  nsid;
+    uint8_t  thread_id;
 };
 
-static struct nsid_token_pair test_ns_token_table[THREAD_NUM_MAX];
+static struct nsid_token_pair test_ns_token_table[NSID_MGR_TABLE_SIZE];
+static uint32_t nr_token_entries;
+
+/*
+ * Fibonacci hashing: the high bits of the product by 2^32 / phi depend on all
+ * the bits of the token, so the tokens which differ in a few low bits only are
+ * spread across the table.
+ */
+static inline uint32_t token_hash(uint32_t token)
+{
+    return (token * 2654435761U) >> (32 - NSID_MGR_TABLE_BITS);
+}
+
+static inline uint32_t next_entry(uint32_t idx)
+{
+    return (idx + 1) & (NSID_MGR_TABLE_SIZE - 1);
+}
+
+/*
+ * Return the entry of the token, or the free entry ending its probe sequence
+ * if the token is not in the table.
+ */
+static uint32_t find_entry(uint32_t token)
+{
+    uint32_t idx = token_hash(token);
+
+    while ((test_ns_token_table[idx].token != TFM_NS_CLIENT_INVALID_TOKEN) &&
+           (test_ns_token_table[idx].token != token)) {
+        idx = next_entry(idx);
+    }
+
+    return idx;
+}
 
 uint8_t nsid_mgr_init(void)
 {
     uint32_t i;
 
-    for (i = 0; i < THREAD_NUM_MAX; i++) {
+    for (i = 0; i < NSID_MGR_TABLE_SIZE; i++) {
         test_ns_token_table[i].token = TFM_NS_CLIENT_INVALID_TOKEN;
         test_ns_token_table[i].nsid = TFM_INVALID_NSID_MIN;
+        test_ns_token_table[i].thread_id = 0;
     }
 
+    nr_token_entries = 0;
+
     return NSID_MGR_ERR_SUCCESS;
 }
 
-uint8_t nsid_mgr_add_entry(int32_t nsid, uint32_t token)
+uint8_t nsid_mgr_add_entry(int32_t nsid, uint32_t token, uint8_t thread_id)
 {
-    uint32_t i;
+    uint32_t idx;
 
     if (nsid >= TFM_INVALID_NSID_MIN) {
         return NSID_MGR_ERR_INVALID_NSID;
@@ -45,53 +106,95 @@ uint8_t nsid_mgr_add_entry(int32_t nsid, uint32_t token)
         return NSID_MGR_ERR_INVALID_TOKEN;
     }
 
-    for (i = 0; i < THREAD_NUM_MAX; i++) {
-        if (test_ns_token_table[i].token == TFM_NS_CLIENT_INVALID_TOKEN) {
-            test_ns_token_table[i].token = token;
-            test_ns_token_table[i].nsid = nsid;
-            return NSID_MGR_ERR_SUCCESS;
-        }
+    idx = find_entry(token);
+    if (test_ns_token_table[idx].token == token) {
+        test_ns_token_table[idx].nsid = nsid;
+        test_ns_token_table[idx].thread_id = thread_id;
+        return NSID_MGR_ERR_SUCCESS;
     }
 
     /* No free entry for new token, return error */
-    return NSID_MGR_ERR_NO_FREE_ENTRY;
+    if (nr_token_entries >= THREAD_NUM_MAX) {
+        return NSID_MGR_ERR_NO_FREE_ENTRY;
+    }
+
+    test_ns_token_table[idx].token = token;
+    test_ns_token_table[idx].nsid = nsid;
+    test_ns_token_table[idx].thread_id = thread_id;
+    nr_token_entries++;
+
+    return NSID_MGR_ERR_SUCCESS;
 }
 
 uint8_t nsid_mgr_remove_entry(uint32_t token)
 {
-    uint32_t i;
+    uint32_t idx, next, home;
 
     if (token == TFM_NS_CLIENT_INVALID_TOKEN) {
         return NSID_MGR_ERR_INVALID_TOKEN;
     }
 
-    for (i = 0; i < THREAD_NUM_MAX; i++) {
-        if (test_ns_token_table[i].token == token) {
-            test_ns_token_table[i].token = TFM_NS_CLIENT_INVALID_TOKEN;
-            test_ns_token_table[i].nsid = TFM_INVALID_NSID_MIN;
-            return NSID_MGR_ERR_SUCCESS;
+    idx = find_entry(token);
+
+    /* Token not found in the table, return error */
+    if (test_ns_token_table[idx].token != token) {
+        return NSID_MGR_ERR_INVALID_TOKEN;
+    }
+
+    /*
+     * Move back the following entries of the probe sequence which could no
+     * longer be found past the removed one, instead of leaving a tombstone.
+     */
+    next = next_entry(idx);
+    while (test_ns_token_table[next].token != TFM_NS_CLIENT_INVALID_TOKEN) {
+        home = token_hash(test_ns_token_table[next].token);
+
+        /* Whether the home entry is cyclically outside (idx, next] */
+        if ((idx <= next) ? ((home <= idx) || (home > next)) :
+                            ((home <= idx) && (home > next))) {
+            test_ns_token_table[idx] = test_ns_token_table[next];
+            idx = next;
         }
+
+        next = next_entry(next);
     }
 
-    /* Token not found in the table, return error */
-    return NSID_MGR_ERR_INVALID_TOKEN;
+    test_ns_token_table[idx].token = TFM_NS_CLIENT_INVALID_TOKEN;
+    test_ns_token_table[idx].nsid = TFM_INVALID_NSID_MIN;
+    test_ns_token_table[idx].thread_id = 0;
+    nr_token_entries--;
+
+    return NSID_MGR_ERR_SUCCESS;
 }
 
 int32_t nsid_mgr_query_nsid(uint32_t token)
 {
-    uint32_t i;
+    uint32_t idx;
 
     /* Return invalid NSID if token is invalid */
     if (token == TFM_NS_CLIENT_INVALID_TOKEN) {
         return TFM_INVALID_NSID_MIN;
     }
 
-    for (i = 0; i < THREAD_NUM_MAX; i++) {
-        if (test_ns_token_table[i].token == token) {
-            return test_ns_token_table[i].nsid;
-        }
+    /*
+     * Return invalid NSID if token is not found in the table, as held by the
+     * free entry ending the probe sequence.
+     */
+    idx = find_entry(token);
+
+    return test_ns_token_table[idx].nsid;
+}
+
+uint8_t nsid_mgr_query_thread_id(uint32_t token)
+{
+    uint32_t idx;
+
+    if (token == TFM_NS_CLIENT_INVALID_TOKEN) {
+        return 0;
     }
 
-    /* Token not found in the table, return invalid NSID */
-    return TFM_INVALID_NSID_MIN;
+    /* The free entry ending the probe sequence holds thread ID 0 */
+    idx = find_entry(token);
+
+    return test_ns_token_table[idx].thread_id;
 }
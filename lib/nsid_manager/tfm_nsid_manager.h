@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -13,6 +13,7 @@
 #ifndef __TFM_NSID_MANAGER_H__
 #define __TFM_NSID_MANAGER_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -42,6 +43,18 @@ extern "C" {
 extern uint32_t current_active_token;
 #endif
 
+/*
+ * Secure context switches requested by the RTOS and performed in SPE.
+ * The requests not performed are the secure entries avoided by
+ * TFM_NS_NSID_LAZY_CONTEXT.
+ */
+struct nsid_mgr_ctx_stats_t {
+    uint32_t nr_load_reqs;      /* TZ_LoadContext_S() calls */
+    uint32_t nr_store_reqs;     /* TZ_StoreContext_S() calls */
+    uint32_t nr_loads;          /* Contexts loaded in SPE */
+    uint32_t nr_stores;         /* Contexts stored in SPE */
+};
+
 /*
  * Initialize the table to map token and nsid.
  * This function should be called before any other NSID manager APIs.
@@ -49,11 +62,12 @@ extern uint32_t current_active_token;
 uint8_t nsid_mgr_init(void);
 
 /*
- * Add a new nsid-token map entry to the table.
+ * Add a new nsid-token map entry to the table, with the thread ID
+ * the token has been assigned to.
  * This function should be called once a new token
  * has been successfully assigned by ns_client_ext.
  */
-uint8_t nsid_mgr_add_entry(int32_t nsid, uint32_t token);
+uint8_t nsid_mgr_add_entry(int32_t nsid, uint32_t token, uint8_t thread_id);
 
 /*
  * Delete a nsid-token map entry from the table.
@@ -68,6 +82,36 @@ uint8_t nsid_mgr_remove_entry(uint32_t token);
  */
 int32_t nsid_mgr_query_nsid(uint32_t token);
 
+/*
+ * Query the thread ID from the map table with token.
+ * This function is to get the thread ID of a NS thread to reuse it
+ * once the token is released. Return 0 if the token is not found.
+ */
+uint8_t nsid_mgr_query_thread_id(uint32_t token);
+
+/*
+ * Reload the secure context of the running thread with another NSID.
+ * The thread then makes its PSA client calls on behalf of that NS client,
+ * such as a server forwarding the calls of remote clients. The caller must
+ * not be switched out meanwhile, e.g. the RTOS scheduler is locked.
+ * This function is implemented in the TZ shim layer.
+ */
+uint8_t nsid_mgr_switch_nsid(int32_t nsid);
+
+/*
+ * Whether the thread the RTOS switches in next has a secure context. It is
+ * called from the TZ context management functions during a context switch.
+ * This function is implemented by the RTOS port, and is only required by
+ * TFM_NS_NSID_LAZY_CONTEXT.
+ */
+bool nsid_mgr_next_thread_has_context(void);
+
+/*
+ * Get the statistics of the secure context switches.
+ * This function is implemented in the TZ shim layer.
+ */
+void nsid_mgr_get_ctx_stats(struct nsid_mgr_ctx_stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
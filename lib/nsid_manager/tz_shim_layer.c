@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -20,18 +20,135 @@
 #ifdef TFM_NS_MANAGE_NSID
 #define NSID_MGR_THREAD_ID_MAX       0xFF
 #define NSID_MGR_GROUP_ID_DEFAULT    0X00
+#define NSID_MGR_THREAD_ID_WORDS     ((NSID_MGR_THREAD_ID_MAX + 32) / 32)
 /*
  * 0 is reserved for thread ID in NSID manager to avoid token being set as 0.
  * TZ_MemoryID_t is used to record the token value.
  * Scheduler of the RTOS would be disabled if TZ_MemoryID_t is 0.
+ *
+ * The thread IDs in use are set in the bitmap. The IDs from
+ * NSID_MGR_THREAD_ID_MAX are never allocated. The ID of a released token is
+ * reused, so that threads can be created and deleted for ever.
  */
-static uint8_t nsid_mgr_thread_id = 1;
+static uint32_t nsid_mgr_thread_id_bitmap[NSID_MGR_THREAD_ID_WORDS];
+
+static void nsid_mgr_thread_id_init(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < NSID_MGR_THREAD_ID_WORDS; i++) {
+        nsid_mgr_thread_id_bitmap[i] = 0;
+    }
+
+    /* Reserve thread ID 0 and the IDs from NSID_MGR_THREAD_ID_MAX */
+    nsid_mgr_thread_id_bitmap[0] = 0x1U;
+    for (i = NSID_MGR_THREAD_ID_MAX; i < NSID_MGR_THREAD_ID_WORDS * 32; i++) {
+        nsid_mgr_thread_id_bitmap[i / 32] |= 0x1U << (i % 32);
+    }
+}
+
+/* Allocate the lowest free thread ID. Return 0 if none is free. */
+static uint8_t nsid_mgr_thread_id_alloc(void)
+{
+    uint32_t i, free_ids, bit;
+
+    for (i = 0; i < NSID_MGR_THREAD_ID_WORDS; i++) {
+        free_ids = ~nsid_mgr_thread_id_bitmap[i];
+        if (!free_ids) {
+            continue;
+        }
+
+#if defined(__GNUC__)
+        bit = (uint32_t)__builtin_ctz(free_ids);
+#else
+        bit = 0;
+        while (!(free_ids & (0x1U << bit))) {
+            bit++;
+        }
+#endif
+        nsid_mgr_thread_id_bitmap[i] |= 0x1U << bit;
+
+        return (uint8_t)(i * 32 + bit);
+    }
+
+    return 0;
+}
+
+static void nsid_mgr_thread_id_free(uint8_t thread_id)
+{
+    if (!thread_id || (thread_id >= NSID_MGR_THREAD_ID_MAX)) {
+        return;
+    }
+
+    nsid_mgr_thread_id_bitmap[thread_id / 32] &= ~(0x1U << (thread_id % 32));
+}
 #endif
 
 #ifdef TEST_NS_MANAGE_NSID
 uint32_t current_active_token;
 #endif
 
+#ifdef TFM_NS_MANAGE_NSID
+static struct nsid_mgr_ctx_stats_t ctx_stats;
+
+/* Token of the running thread, invalid if it has no secure context */
+static uint32_t running_token = TFM_NS_CLIENT_INVALID_TOKEN;
+
+#ifdef TFM_NS_NSID_LAZY_CONTEXT
+/*
+ * In the lazy context mode, the secure context of a thread stays loaded in SPE
+ * when the thread is switched out for a thread with secure context. It is only
+ * stored when a thread of another NSID is switched in, so the switches between
+ * threads of the same NSID do not enter SPE at all.
+ *
+ * The RTOS does not call TZ_LoadContext_S() for the threads without secure
+ * context, so the context is stored before one of them is switched in. Their
+ * PSA client calls are then made without secure context, as in the default
+ * mode, instead of with the NSID of the previous thread. The switches between
+ * them do not enter SPE in either mode. The RTOS port tells which thread is
+ * switched in with nsid_mgr_next_thread_has_context().
+ */
+static uint32_t loaded_token = TFM_NS_CLIENT_INVALID_TOKEN;
+static int32_t loaded_nsid = TFM_INVALID_NSID_MIN;
+
+/* Store the context left loaded in SPE, if any */
+static uint32_t store_loaded_context(void)
+{
+    if (loaded_token == TFM_NS_CLIENT_INVALID_TOKEN) {
+        return TFM_NS_CLIENT_ERR_SUCCESS;
+    }
+
+    if (tfm_nsce_save_ctx(loaded_token) != TFM_NS_CLIENT_ERR_SUCCESS) {
+        return TFM_NS_CLIENT_ERR_INVALID_TOKEN;
+    }
+
+    ctx_stats.nr_stores++;
+    loaded_token = TFM_NS_CLIENT_INVALID_TOKEN;
+    loaded_nsid = TFM_INVALID_NSID_MIN;
+
+    return TFM_NS_CLIENT_ERR_SUCCESS;
+}
+
+/* Load the context of the running thread once the loaded one is stored */
+static uint32_t load_running_context(void)
+{
+    int32_t nsid = nsid_mgr_query_nsid(running_token);
+
+    if ((nsid >= TFM_INVALID_NSID_MIN) ||
+        (tfm_nsce_load_ctx(running_token, nsid) !=
+         TFM_NS_CLIENT_ERR_SUCCESS)) {
+        return TFM_NS_CLIENT_ERR_INVALID_TOKEN;
+    }
+
+    ctx_stats.nr_loads++;
+    loaded_token = running_token;
+    loaded_nsid = nsid;
+
+    return TFM_NS_CLIENT_ERR_SUCCESS;
+}
+#endif /* TFM_NS_NSID_LAZY_CONTEXT */
+#endif /* TFM_NS_MANAGE_NSID */
+
 /*
  * TF-M shim layer of the CMSIS TZ RTOS thread context management API
  */
@@ -48,6 +165,8 @@ uint32_t TZ_InitContextSystem_S(void)
         return 0U;    /* Error */
     }
 
+    nsid_mgr_thread_id_init();
+
     /* Initialize the nsid manager */
     if (nsid_mgr_init() == NSID_MGR_ERR_SUCCESS) {
 #ifdef TEST_NS_MANAGE_NSID
@@ -73,20 +192,23 @@ TZ_MemoryId_t TZ_AllocModuleContext_S(TZ_ModuleId_t module)
 #ifdef TFM_NS_MANAGE_NSID
     int32_t nsid;
     uint32_t token;
+    uint8_t thread_id;
 
     /* TZ_ModuleID_t is used to record NSID */
     nsid = (int32_t)module;
 
     /* New thread ID not available, return error */
-    if (nsid_mgr_thread_id >= NSID_MGR_THREAD_ID_MAX) {
+    thread_id = nsid_mgr_thread_id_alloc();
+    if (!thread_id) {
         return 0U;    /* Error */
     }
 
-    token = tfm_nsce_acquire_ctx(NSID_MGR_GROUP_ID_DEFAULT, nsid_mgr_thread_id++);
+    token = tfm_nsce_acquire_ctx(NSID_MGR_GROUP_ID_DEFAULT, thread_id);
 
-    if (nsid_mgr_add_entry(nsid, token) == NSID_MGR_ERR_SUCCESS) {
+    if (nsid_mgr_add_entry(nsid, token, thread_id) == NSID_MGR_ERR_SUCCESS) {
         return token;    /* Success: return token as TZ_MemoryId_t */
     } else {
+        nsid_mgr_thread_id_free(thread_id);
         return 0U;    /* Error */
     }
 #else /* TFM_NS_MANAGE_NSID */
@@ -103,19 +225,59 @@ uint32_t TZ_FreeModuleContext_S(TZ_MemoryId_t id)
 {
 #ifdef TFM_NS_MANAGE_NSID
     uint32_t token;
+    uint8_t thread_id;
 
     /* TZ_MemoryId_t is used to record token */
     token = (uint32_t)id;
 
+    thread_id = nsid_mgr_query_thread_id(token);
+    if (!thread_id) {
+        return 0U;    /* Error */
+    }
+
+#ifdef TFM_NS_NSID_LAZY_CONTEXT
+    /*
+     * The context of a terminated thread can still be loaded. A thread which
+     * exits is switched out without TZ_StoreContext_S().
+     */
+    if ((token == loaded_token) ||
+        ((token == running_token) && !nsid_mgr_next_thread_has_context())) {
+        if (store_loaded_context() != TFM_NS_CLIENT_ERR_SUCCESS) {
+            return 0U;    /* Error */
+        }
+
+        /*
+         * Another thread of the same NSID can be running on that context, and
+         * no context switch follows to load its own one.
+         */
+        if ((running_token != TFM_NS_CLIENT_INVALID_TOKEN) &&
+            (running_token != token) &&
+            (load_running_context() != TFM_NS_CLIENT_ERR_SUCCESS)) {
+            return 0U;    /* Error */
+        }
+    }
+#endif
+
     if (nsid_mgr_remove_entry(token) != NSID_MGR_ERR_SUCCESS) {
         return 0U;    /* Error */
     }
 
+    if (token == running_token) {
+        running_token = TFM_NS_CLIENT_INVALID_TOKEN;
+    }
+
     if (tfm_nsce_release_ctx(token) == TFM_NS_CLIENT_ERR_SUCCESS) {
+        /* The thread ID can be assigned to a new thread */
+        nsid_mgr_thread_id_free(thread_id);
 #ifdef TEST_NS_MANAGE_NSID
+#ifdef TFM_NS_NSID_LAZY_CONTEXT
+        /* Another context can still be loaded */
+        current_active_token = loaded_token;
+#else
         if (current_active_token != TFM_NS_CLIENT_INVALID_TOKEN) {
             current_active_token = TFM_NS_CLIENT_INVALID_TOKEN;
         }
+#endif
 #endif
         return 1U;    /* Success */
     } else {
@@ -146,7 +308,27 @@ uint32_t TZ_LoadContext_S(TZ_MemoryId_t id)
         return 0U;    /* Error */
     }
 
+    ctx_stats.nr_load_reqs++;
+    running_token = token;
+
+#ifdef TFM_NS_NSID_LAZY_CONTEXT
+    /* The loaded context already provides the NSID of the thread */
+    if ((loaded_token != TFM_NS_CLIENT_INVALID_TOKEN) &&
+        (loaded_nsid == nsid)) {
+        return 1U;    /* Success */
+    }
+
+    if (store_loaded_context() != TFM_NS_CLIENT_ERR_SUCCESS) {
+        return 0U;    /* Error */
+    }
+#endif
+
     if (tfm_nsce_load_ctx(token, nsid) == TFM_NS_CLIENT_ERR_SUCCESS) {
+        ctx_stats.nr_loads++;
+#ifdef TFM_NS_NSID_LAZY_CONTEXT
+        loaded_token = token;
+        loaded_nsid = nsid;
+#endif
 #ifdef TEST_NS_MANAGE_NSID
         current_active_token = token;
 #endif
@@ -172,7 +354,23 @@ uint32_t TZ_StoreContext_S(TZ_MemoryId_t id)
     /* TZ_MemoryId_t is used to record token */
     token = (uint32_t)id;
 
+    ctx_stats.nr_store_reqs++;
+    running_token = TFM_NS_CLIENT_INVALID_TOKEN;
+
+#ifdef TFM_NS_NSID_LAZY_CONTEXT
+    /* Keep the context loaded until a thread of another NSID is switched in */
+    (void)token;
+    if (!nsid_mgr_next_thread_has_context() &&
+        (store_loaded_context() != TFM_NS_CLIENT_ERR_SUCCESS)) {
+        return 0U;    /* Error */
+    }
+#ifdef TEST_NS_MANAGE_NSID
+    current_active_token = loaded_token;
+#endif
+    return 1U;    /* Success */
+#else
     if (tfm_nsce_save_ctx(token) == TFM_NS_CLIENT_ERR_SUCCESS) {
+        ctx_stats.nr_stores++;
 #ifdef TEST_NS_MANAGE_NSID
         if (current_active_token != TFM_NS_CLIENT_INVALID_TOKEN) {
             current_active_token = TFM_NS_CLIENT_INVALID_TOKEN;
@@ -182,7 +380,73 @@ uint32_t TZ_StoreContext_S(TZ_MemoryId_t id)
     } else {
         return 0U;    /* Error */
     }
+#endif /* TFM_NS_NSID_LAZY_CONTEXT */
 #else /* TFM_NS_MANAGE_NSID */
     return 1U;    /* Success */
 #endif /* TFM_NS_MANAGE_NSID */
 }
+
+uint8_t nsid_mgr_switch_nsid(int32_t nsid)
+{
+#ifdef TFM_NS_MANAGE_NSID
+    uint32_t token = running_token;
+    uint8_t thread_id;
+
+    if (nsid >= TFM_INVALID_NSID_MIN) {
+        return NSID_MGR_ERR_INVALID_NSID;
+    }
+
+    if (token == TFM_NS_CLIENT_INVALID_TOKEN) {
+        return NSID_MGR_ERR_INVALID_TOKEN;
+    }
+
+    /* The next context switches load the thread with the new NSID */
+    thread_id = nsid_mgr_query_thread_id(token);
+    if ((nsid_mgr_remove_entry(token) != NSID_MGR_ERR_SUCCESS) ||
+        (nsid_mgr_add_entry(nsid, token, thread_id) != NSID_MGR_ERR_SUCCESS)) {
+        return NSID_MGR_ERR_INVALID_TOKEN;
+    }
+
+#ifdef TFM_NS_NSID_LAZY_CONTEXT
+    if (store_loaded_context() != TFM_NS_CLIENT_ERR_SUCCESS) {
+        return NSID_MGR_ERR_INVALID_TOKEN;
+    }
+#else
+    if (tfm_nsce_save_ctx(token) != TFM_NS_CLIENT_ERR_SUCCESS) {
+        return NSID_MGR_ERR_INVALID_TOKEN;
+    }
+    ctx_stats.nr_stores++;
+#endif
+
+    if (tfm_nsce_load_ctx(token, nsid) != TFM_NS_CLIENT_ERR_SUCCESS) {
+        return NSID_MGR_ERR_INVALID_TOKEN;
+    }
+    ctx_stats.nr_loads++;
+
+#ifdef TFM_NS_NSID_LAZY_CONTEXT
+    loaded_token = token;
+    loaded_nsid = nsid;
+#endif
+#ifdef TEST_NS_MANAGE_NSID
+    current_active_token = token;
+#endif
+
+    return NSID_MGR_ERR_SUCCESS;
+#else /* TFM_NS_MANAGE_NSID */
+    (void)nsid;
+
+    return NSID_MGR_ERR_INVALID_NSID;
+#endif /* TFM_NS_MANAGE_NSID */
+}
+
+void nsid_mgr_get_ctx_stats(struct nsid_mgr_ctx_stats_t *stats)
+{
+#ifdef TFM_NS_MANAGE_NSID
+    *stats = ctx_stats;
+#else
+    stats->nr_load_reqs = 0;
+    stats->nr_store_reqs = 0;
+    stats->nr_loads = 0;
+    stats->nr_stores = 0;
+#endif
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited. All rights reserved.
  * Copyright (c) 2023 Cypress Semiconductor Corporation (an Infineon company)
  * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
@@ -47,6 +47,45 @@ void *os_wrapper_msg_queue_create(size_t msg_size, uint8_t msg_count);
 int32_t os_wrapper_msg_queue_send(void *mq_handle,
                                   const void *msg_ptr);
 
+/**
+ * \brief Send a message via message queue with a priority
+ *
+ * \param[in] mq_handle       The handle of message queue
+ * \param[in] msg_ptr         The pointer to the message to be sent
+ * \param[in] priority        The priority of the message. The messages with a
+ *                            higher value are received first. The messages
+ *                            with the same priority are received in FIFO
+ *                            order.
+ *
+ * \return \ref OS_WRAPPER_SUCCESS if the message is successfully sent, or
+ *         \ref OS_WRAPPER_ERROR in case of error
+ *
+ * \note \ref os_wrapper_msg_queue_send is the same as priority 0.
+ */
+int32_t os_wrapper_msg_queue_send_prio(void *mq_handle,
+                                       const void *msg_ptr,
+                                       uint8_t priority);
+
+/**
+ * \brief Send a message via message queue, waiting for a free entry if the
+ *        queue is full
+ *
+ * \param[in] mq_handle       The handle of message queue
+ * \param[in] msg_ptr         The pointer to the message to be sent
+ * \param[in] priority        The priority of the message, as in
+ *                            \ref os_wrapper_msg_queue_send_prio
+ * \param[in] timeout         The maximum time to wait, in ticks. 0 returns
+ *                            instantly and \ref OS_WRAPPER_WAIT_FOREVER
+ *                            waits until the message is sent.
+ *
+ * \return \ref OS_WRAPPER_SUCCESS if the message is successfully sent, or
+ *         \ref OS_WRAPPER_ERROR in case of error or time out
+ */
+int32_t os_wrapper_msg_queue_send_timeout(void *mq_handle,
+                                          const void *msg_ptr,
+                                          uint8_t priority,
+                                          uint32_t timeout);
+
 /**
  * \brief Receive a message from message queue
  *
@@ -65,6 +104,34 @@ int32_t os_wrapper_msg_queue_send(void *mq_handle,
 int32_t os_wrapper_msg_queue_receive(void *mq_handle,
                                      void *msg_ptr);
 
+/**
+ * \brief Receive a message from message queue, waiting for a limited time
+ *
+ * \param[in] mq_handle       The handle of message queue
+ * \param[in] msg_ptr         The pointer to buffer for message to be received
+ * \param[in] timeout         The maximum time to wait, in ticks. 0 returns
+ *                            instantly and \ref OS_WRAPPER_WAIT_FOREVER
+ *                            waits until a message is received.
+ *
+ * \return \ref OS_WRAPPER_SUCCESS if the message is successfully received, or
+ *         \ref OS_WRAPPER_ERROR in case of error or time out
+ */
+int32_t os_wrapper_msg_queue_receive_timeout(void *mq_handle,
+                                             void *msg_ptr,
+                                             uint32_t timeout);
+
+/**
+ * \brief Delete a message queue
+ *
+ * \param[in] mq_handle       The handle of message queue
+ *
+ * \return \ref OS_WRAPPER_SUCCESS if the message queue is deleted, or
+ *         \ref OS_WRAPPER_ERROR in case of error
+ *
+ * \note No thread may wait on the message queue when it is deleted.
+ */
+int32_t os_wrapper_msg_queue_delete(void *mq_handle);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stddef.h>
+
+#include "msg_queue.h"
+#include "semaphore.h"
+#include "thread.h"
+#include "thread_pool.h"
+
+/* A function dispatched to the workers, NULL to stop a worker */
+struct thread_pool_job_t {
+    os_wrapper_thread_func func;
+    void *arg;
+};
+
+static void thread_pool_worker(void *arg)
+{
+    struct os_wrapper_thread_pool_t *pool = arg;
+    struct thread_pool_job_t job;
+
+    while (1) {
+        if ((os_wrapper_msg_queue_receive(pool->job_queue, &job) !=
+             OS_WRAPPER_SUCCESS) || !job.func) {
+            /* The pool must not be accessed any more once it is released */
+            (void)os_wrapper_semaphore_release(pool->exit_sema);
+            os_wrapper_thread_exit();
+        }
+
+        job.func(job.arg);
+    }
+}
+
+uint32_t os_wrapper_thread_pool_init(struct os_wrapper_thread_pool_t *pool,
+                                     const char *name, int32_t stack_size,
+                                     uint32_t priority, uint8_t nr_workers)
+{
+    uint8_t i;
+
+    if (!pool || !nr_workers) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    if (nr_workers > OS_WRAPPER_THREAD_POOL_MAX_WORKERS) {
+        nr_workers = OS_WRAPPER_THREAD_POOL_MAX_WORKERS;
+    }
+
+    pool->nr_workers = 0;
+
+    pool->job_queue = os_wrapper_msg_queue_create(
+                                              sizeof(struct thread_pool_job_t),
+                                              nr_workers);
+    if (!pool->job_queue) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    pool->exit_sema = os_wrapper_semaphore_create(nr_workers, 0, NULL);
+    if (!pool->exit_sema) {
+        (void)os_wrapper_msg_queue_delete(pool->job_queue);
+        pool->job_queue = NULL;
+        return OS_WRAPPER_ERROR;
+    }
+
+    for (i = 0; i < nr_workers; i++) {
+        pool->workers[i] = os_wrapper_thread_new(name, stack_size,
+                                                 thread_pool_worker, pool,
+                                                 priority);
+        if (!pool->workers[i]) {
+            break;
+        }
+    }
+
+    /* Keep the queue with the workers created */
+    pool->nr_workers = i;
+    if (!pool->nr_workers) {
+        (void)os_wrapper_semaphore_delete(pool->exit_sema);
+        (void)os_wrapper_msg_queue_delete(pool->job_queue);
+        pool->exit_sema = NULL;
+        pool->job_queue = NULL;
+        return OS_WRAPPER_ERROR;
+    }
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+uint32_t os_wrapper_thread_pool_dispatch(struct os_wrapper_thread_pool_t *pool,
+                                         os_wrapper_thread_func func,
+                                         void *arg)
+{
+    struct thread_pool_job_t job = {
+        .func = func,
+        .arg = arg
+    };
+
+    if (!pool || !pool->nr_workers || !func) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    if (os_wrapper_msg_queue_send_timeout(pool->job_queue, &job, 0,
+                                          OS_WRAPPER_WAIT_FOREVER) !=
+        OS_WRAPPER_SUCCESS) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    return OS_WRAPPER_SUCCESS;
+}
+
+uint32_t os_wrapper_thread_pool_delete(struct os_wrapper_thread_pool_t *pool)
+{
+    struct thread_pool_job_t job = {
+        .func = NULL,
+        .arg = NULL
+    };
+    uint32_t ret = OS_WRAPPER_SUCCESS;
+    uint8_t i;
+
+    if (!pool || !pool->nr_workers) {
+        return OS_WRAPPER_ERROR;
+    }
+
+    /* Each worker exits when it receives a stop job, after the queued ones */
+    for (i = 0; i < pool->nr_workers; i++) {
+        if (os_wrapper_msg_queue_send_timeout(pool->job_queue, &job, 0,
+                                              OS_WRAPPER_WAIT_FOREVER) !=
+            OS_WRAPPER_SUCCESS) {
+            return OS_WRAPPER_ERROR;
+        }
+    }
+
+    /*
+     * Wait for the workers to signal their end, rather than for their handles,
+     * which the RTOS can free and reuse as soon as the threads exit.
+     */
+    for (i = 0; i < pool->nr_workers; i++) {
+        if (os_wrapper_semaphore_acquire(pool->exit_sema,
+                                         OS_WRAPPER_WAIT_FOREVER) !=
+            OS_WRAPPER_SUCCESS) {
+            return OS_WRAPPER_ERROR;
+        }
+    }
+
+    for (i = 0; i < pool->nr_workers; i++) {
+        if (os_wrapper_thread_join(pool->workers[i]) != OS_WRAPPER_SUCCESS) {
+            ret = OS_WRAPPER_ERROR;
+        }
+        pool->workers[i] = NULL;
+    }
+
+    if ((os_wrapper_semaphore_delete(pool->exit_sema) != OS_WRAPPER_SUCCESS) ||
+        (os_wrapper_msg_queue_delete(pool->job_queue) != OS_WRAPPER_SUCCESS)) {
+        ret = OS_WRAPPER_ERROR;
+    }
+
+    pool->exit_sema = NULL;
+    pool->job_queue = NULL;
+    pool->nr_workers = 0;
+
+    return ret;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited. All rights reserved.
  * Copyright (c) 2023 Cypress Semiconductor Corporation (an Infineon company)
  * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
@@ -58,6 +58,24 @@ uint32_t os_wrapper_thread_get_priority(void *handle, uint32_t *priority);
  */
 __attribute__((noreturn)) void os_wrapper_thread_exit(void);
 
+/**
+ * \brief Releases the handle of a thread created by \ref os_wrapper_thread_new
+ *        once it exits
+ *
+ * \note The caller must first synchronize with the end of the thread, e.g.
+ *       with a semaphore released by the thread right before it exits. Some
+ *       RTOSes free an exited thread at once and reuse its handle for a new
+ *       thread, so that the handle can neither be waited for nor used after
+ *       the thread exits. Others keep the handle valid until this function is
+ *       called. It must not be used afterwards.
+ *
+ * \param[in] handle    Thread handle
+ *
+ * \return Returns \ref OS_WRAPPER_SUCCESS on success, or \ref OS_WRAPPER_ERROR
+ *         in case of error
+ */
+uint32_t os_wrapper_thread_join(void *handle);
+
 /**
  * \brief Set the event flags for synchronizing a thread specified by handle.
  *
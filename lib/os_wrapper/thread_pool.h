@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __OS_WRAPPER_THREAD_POOL_H__
+#define __OS_WRAPPER_THREAD_POOL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "os_wrapper/common.h"
+#include "os_wrapper/thread.h"
+
+/*
+ * A pool of worker threads which run the dispatched functions one after the
+ * other. The workers and their stacks are created once when the pool is
+ * initialized and are kept until the pool is deleted, so that short-lived
+ * tasks do not pay for a thread creation each time.
+ *
+ * It is implemented on top of the other OS wrapper APIs.
+ */
+
+/* The maximum number of worker threads of a pool */
+#ifndef OS_WRAPPER_THREAD_POOL_MAX_WORKERS
+#define OS_WRAPPER_THREAD_POOL_MAX_WORKERS  16
+#endif
+
+struct os_wrapper_thread_pool_t {
+    void *job_queue;            /* The functions waiting for a worker */
+    void *exit_sema;            /* Released by each worker when it exits */
+    uint8_t nr_workers;         /* The number of worker threads */
+    void *workers[OS_WRAPPER_THREAD_POOL_MAX_WORKERS]; /* The worker handles */
+};
+
+/**
+ * \brief Initialize a thread pool and start its worker threads
+ *
+ * \param[out] pool       The thread pool, which must stay valid as long as the
+ *                        workers run
+ * \param[in] name        Name of the worker threads
+ * \param[in] stack_size  Stack size of each worker thread, as in
+ *                        \ref os_wrapper_thread_new
+ * \param[in] priority    Priority of the worker threads
+ * \param[in] nr_workers  The number of worker threads to create, up to
+ *                        OS_WRAPPER_THREAD_POOL_MAX_WORKERS
+ *
+ * \return Returns \ref OS_WRAPPER_SUCCESS if at least one worker is created,
+ *         or \ref OS_WRAPPER_ERROR in case of error. The number of created
+ *         workers is set in the pool.
+ */
+uint32_t os_wrapper_thread_pool_init(struct os_wrapper_thread_pool_t *pool,
+                                     const char *name, int32_t stack_size,
+                                     uint32_t priority, uint8_t nr_workers);
+
+/**
+ * \brief Run a function in a worker thread of the pool
+ *
+ * \note The function returns to let the worker run the next one. It must not
+ *       call \ref os_wrapper_thread_exit.
+ *
+ * \note The caller blocks while as many functions as workers are queued.
+ *
+ * \param[in] pool        The thread pool
+ * \param[in] func        The function to run
+ * \param[in] arg         Argument to pass to the function
+ *
+ * \return Returns \ref OS_WRAPPER_SUCCESS on success, or \ref OS_WRAPPER_ERROR
+ *         in case of error
+ */
+uint32_t os_wrapper_thread_pool_dispatch(struct os_wrapper_thread_pool_t *pool,
+                                         os_wrapper_thread_func func,
+                                         void *arg);
+
+/**
+ * \brief Stop the worker threads of a pool and release its resources
+ *
+ * \details The functions already dispatched are run before the workers exit.
+ *          The pool can be initialized again afterwards.
+ *
+ * \note It must not be called from a worker thread of the pool, nor while
+ *       other threads dispatch functions to it.
+ *
+ * \param[in] pool        The thread pool
+ *
+ * \return Returns \ref OS_WRAPPER_SUCCESS on success, or \ref OS_WRAPPER_ERROR
+ *         in case of error
+ */
+uint32_t os_wrapper_thread_pool_delete(struct os_wrapper_thread_pool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __OS_WRAPPER_THREAD_POOL_H__ */
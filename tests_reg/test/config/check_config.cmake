@@ -1,5 +1,5 @@
 #-------------------------------------------------------------------------------
-# Copyright (c) 2021-2025, Arm Limited. All rights reserved.
+# Copyright (c) 2021-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -16,11 +16,20 @@ tfm_invalid_config(NOT TFM_PARTITION_FIRMWARE_UPDATE AND (TEST_NS_FWU OR TEST_S_
 
 tfm_invalid_config(TFM_PXN_ENABLE AND PS_TEST_NV_COUNTERS)
 
+tfm_invalid_config(TEST_NS_PARALLEL_SUITES AND CONFIG_TFM_ERPC_TEST_FRAMEWORK)
+tfm_invalid_config(TEST_NS_PARALLEL_SUITES AND (TEST_NS_PARALLEL_WORKERS LESS 1))
+tfm_invalid_config(TEST_NS_PARALLEL_SELF_TEST AND NOT TEST_NS_PARALLEL_SUITES)
+if(TEST_NS_PARALLEL_SUITES)
+    # RTX only creates threads whose stack size is a multiple of 8 bytes
+    math(EXPR TEST_NS_PARALLEL_STACK_SIZE_REM "${TEST_NS_PARALLEL_STACK_SIZE} % 8")
+    tfm_invalid_config(NOT TEST_NS_PARALLEL_STACK_SIZE_REM EQUAL 0)
+endif()
+
 tfm_invalid_config((TEST_NS_IPC OR TEST_S_IPC) AND CONFIG_TFM_SPM_BACKEND_SFN)
 tfm_invalid_config(TEST_S_SFN_BACKEND AND CONFIG_TFM_SPM_BACKEND_IPC)
 
 tfm_invalid_config(CONFIG_TFM_FLOAT_ABI STREQUAL "soft" AND (TEST_S_FPU OR TEST_NS_FPU))
-tfm_invalid_config((NOT TFM_MULTI_CORE_TOPOLOGY) AND TEST_NS_MULTI_CORE)
+tfm_invalid_config((NOT TFM_MULTI_CORE_TOPOLOGY) AND (NOT CONFIG_TFM_ERPC_TEST_FRAMEWORK) AND TEST_NS_MULTI_CORE)
 tfm_invalid_config((NOT TFM_NS_MANAGE_NSID) AND TEST_NS_MANAGE_NSID)
 tfm_invalid_config(TFM_PXN_ENABLE AND PS_TEST_NV_COUNTERS)
 
@@ -1,5 +1,5 @@
 #-------------------------------------------------------------------------------
-# Copyright (c) 2021-2023, Arm Limited. All rights reserved.
+# Copyright (c) 2021-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -46,3 +46,13 @@ set(TFM_CRYPTO_TEST_WP_SECP384_R1               OFF      CACHE BOOL      "Test E
 set(TFM_FWU_TEST_REQUEST_REBOOT         OFF         CACHE BOOL      "Test psa_fwu_request_reboot")
 set(TFM_FWU_TEST_WRITE_WITH_NULL        OFF         CACHE BOOL      "Test psa_fwu_write with data block NULL")
 set(TFM_FWU_TEST_QUERY_WITH_NULL        OFF         CACHE BOOL      "Test psa_fwu_query with info NULL")
+
+################################## Test framework ##############################
+
+set(TEST_FRAMEWORK_DWT_TIMESTAMP        OFF         CACHE BOOL      "Use the DWT cycle counter as the test framework timestamp source. Requires privileged access to DWT")
+set(TEST_FRAMEWORK_RESULT_STREAM        OFF         CACHE BOOL      "Output test results as a machine-readable stream instead of coloured text")
+set(TEST_FRAMEWORK_FILTER               ""          CACHE STRING    "Comma-separated glob patterns selecting the test cases or suites to run. Empty runs all")
+set(TEST_NS_PARALLEL_SUITES             OFF         CACHE BOOL      "Run independent non-secure test suites concurrently on RTOS threads")
+set(TEST_NS_PARALLEL_WORKERS            2           CACHE STRING    "Max number of non-secure test suites run concurrently")
+set(TEST_NS_PARALLEL_STACK_SIZE         0x800       CACHE STRING    "Stack size of the threads running the non-secure test suites concurrently")
+set(TEST_NS_PARALLEL_SELF_TEST          OFF         CACHE BOOL      "Add the test suites checking that the non-secure test suites run concurrently")
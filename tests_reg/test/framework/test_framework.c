@@ -1,16 +1,24 @@
 /*
- * Copyright (c) 2017-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
 #include "test_framework.h"
+#ifdef TEST_FRAMEWORK_RESULT_STREAM
+#include "test_framework_stream.h"
+#endif
+#ifdef TEST_FRAMEWORK_PARALLEL
+#include "test_framework_parallel.h"
+#endif
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef TEST_FRAMEWORK_RESULT_STREAM
 static void test_failed(const struct test_result_t *ret, const char *name)
 {
     printf_set_color(RED);
@@ -27,11 +35,196 @@ static void test_failed(const struct test_result_t *ret, const char *name)
 
     TEST_LOG("  TEST: %s - FAILED!\r\n", name);
 }
+#endif /* !TEST_FRAMEWORK_RESULT_STREAM */
 
 static void print_error(const char *err_msg)
 {
+#ifdef TEST_FRAMEWORK_RESULT_STREAM
+    test_stream_error(err_msg);
+#else
     printf_set_color(RED);
     TEST_LOG("Error ( %s )\r\n", err_msg);
+#endif
+}
+
+#ifndef TEST_FRAMEWORK_FILTER
+#define TEST_FRAMEWORK_FILTER ""
+#endif
+
+volatile char test_framework_filter[TEST_FILTER_MAX_LEN] = TEST_FRAMEWORK_FILTER;
+
+/* Filter set by set_test_filter(), overrides test_framework_filter if set */
+static const char *test_filter = NULL;
+
+/* Copy of test_framework_filter, read once before the tests start */
+static char default_filter[TEST_FILTER_MAX_LEN];
+static bool default_filter_read = false;
+
+/* Latency of each timed iteration of the benchmark test being run */
+static uint32_t bench_samples[TEST_BENCH_MAX_ITERATIONS];
+
+static void sort_bench_samples(uint32_t *samples, uint32_t count)
+{
+    uint32_t i, j, val;
+
+    /* Insertion sort, the number of samples is small */
+    for (i = 1; i < count; i++) {
+        val = samples[i];
+        for (j = i; (j > 0) && (samples[j - 1] > val); j--) {
+            samples[j] = samples[j - 1];
+        }
+        samples[j] = val;
+    }
+}
+
+static void run_bench(uint32_t suite_id, const struct test_t *p_test,
+                      struct test_result_t *ret, const char *time_unit)
+{
+    const struct test_bench_t *bench = p_test->bench;
+    uint32_t i, start, mean;
+    uint64_t total = 0;
+
+    for (i = 0; i < bench->warmup; i++) {
+        ret->val = TEST_PASSED;
+        p_test->test(ret);
+        if (ret->val != TEST_PASSED) {
+            return;
+        }
+    }
+
+    for (i = 0; i < bench->iterations; i++) {
+        ret->val = TEST_PASSED;
+        start = test_framework_get_timestamp();
+        p_test->test(ret);
+        bench_samples[i] = test_framework_get_timestamp() - start;
+        if (ret->val != TEST_PASSED) {
+            return;
+        }
+        total += bench_samples[i];
+    }
+
+    if (time_unit == NULL) {
+        return;
+    }
+
+    sort_bench_samples(bench_samples, bench->iterations);
+
+    /* The mean of 32-bit samples fits in 32 bits */
+    mean = (uint32_t)(total / bench->iterations);
+
+#ifdef TEST_FRAMEWORK_RESULT_STREAM
+    test_stream_bench(suite_id, p_test, bench_samples, mean);
+#else
+    (void)suite_id;
+
+    printf_set_color(DEFAULT);
+    TEST_LOG("  Benchmark: %u iterations after %u warm-up iterations\r\n",
+             bench->iterations, bench->warmup);
+    TEST_LOG("  Latency min/median/mean/p99/max: %u/%u/%u/%u/%u %s\r\n",
+             bench_samples[0],
+             bench_samples[(bench->iterations - 1) / 2],
+             mean,
+             bench_samples[(bench->iterations * 99 + 99) / 100 - 1],
+             bench_samples[bench->iterations - 1],
+             time_unit);
+
+    if ((bench->bytes != 0) &&
+        (bench_samples[(bench->iterations - 1) / 2] != 0)) {
+        /* Saturates if the median is too short for the timestamp unit */
+        uint64_t throughput = ((uint64_t)bench->bytes * 1000000U) /
+                              bench_samples[(bench->iterations - 1) / 2];
+
+        if (throughput > UINT32_MAX) {
+            throughput = UINT32_MAX;
+        }
+
+        TEST_LOG("  Throughput: %u bytes per 1000000 %s (median)\r\n",
+                 (uint32_t)throughput, time_unit);
+    }
+#endif /* TEST_FRAMEWORK_RESULT_STREAM */
+}
+
+static const char *get_test_filter(void)
+{
+    uint32_t i;
+
+    if (test_filter != NULL) {
+        return test_filter;
+    }
+
+    if (!default_filter_read) {
+        /* The filter may have been patched in memory, and not terminated */
+        for (i = 0; i < TEST_FILTER_MAX_LEN - 1; i++) {
+            default_filter[i] = test_framework_filter[i];
+            if (default_filter[i] == '\0') {
+                break;
+            }
+        }
+        default_filter[TEST_FILTER_MAX_LEN - 1] = '\0';
+        default_filter_read = true;
+    }
+
+    return default_filter;
+}
+
+/*
+ * Matches str against the glob pattern of pat_len characters in pattern.
+ * '*' matches any sequence of characters and '?' any single character.
+ */
+static bool glob_match(const char *pattern, size_t pat_len, const char *str)
+{
+    size_t p = 0, star_p = 0;
+    const char *star_s = NULL;
+
+    while (*str != '\0') {
+        if ((p < pat_len) && (pattern[p] == '*')) {
+            /* Remember the position to backtrack to */
+            star_p = ++p;
+            star_s = str;
+        } else if ((p < pat_len) &&
+                   ((pattern[p] == '?') || (pattern[p] == *str))) {
+            p++;
+            str++;
+        } else if (star_s != NULL) {
+            /* Let the last '*' match one more character */
+            p = star_p;
+            str = ++star_s;
+        } else {
+            return false;
+        }
+    }
+
+    while ((p < pat_len) && (pattern[p] == '*')) {
+        p++;
+    }
+
+    return p == pat_len;
+}
+
+static bool is_test_selected(const char *filter, const char *suite_name,
+                             const char *test_name)
+{
+    const char *pattern = filter;
+    size_t len;
+
+    if (*filter == '\0') {
+        return true;
+    }
+
+    while (*pattern != '\0') {
+        for (len = 0; (pattern[len] != ',') && (pattern[len] != '\0'); len++) {
+        }
+
+        if ((len != 0) &&
+            (glob_match(pattern, len, suite_name) ||
+             glob_match(pattern, len, test_name))) {
+            return true;
+        }
+
+        pattern += (pattern[len] == ',') ? len + 1 : len;
+    }
+
+    return false;
 }
 
 const char *test_err_to_str(enum test_suite_err_t err)
@@ -52,16 +245,404 @@ const char *test_err_to_str(enum test_suite_err_t err)
     }
 }
 
+/*
+ * Registers the test suite, validates its tests and counts the tests selected
+ * by the filter.
+ */
+static enum test_suite_err_t prepare_testsuite(struct test_suite_t *test_suite,
+                                               const char *filter,
+                                               uint32_t *selected_tests)
+{
+    uint32_t i;
+    const struct test_t *p_test;
+
+    if (test_suite == 0 || test_suite->freg == 0) {
+        print_error("TEST_SUITE_ERR_INVALID_DATA!");
+        return TEST_SUITE_ERR_INVALID_DATA;
+    }
+
+    /* Sets test suite parameters */
+    test_suite->freg(test_suite);
+    if (test_suite->name == 0 || test_suite->list_size == 0) {
+        print_error("TEST_SUITE_ERR_INVALID_DATA!");
+        return TEST_SUITE_ERR_INVALID_DATA;
+    }
+
+    *selected_tests = 0;
+
+    for (i = 0; i < test_suite->list_size; i++) {
+        p_test = &test_suite->test_list[i];
+
+        if (p_test->test == 0 || p_test->name == 0) {
+            print_error("TEST_SUITE_ERR_INVALID_TEST_DATA!");
+            return TEST_SUITE_ERR_INVALID_TEST_DATA;
+        }
+
+        if (p_test->bench != 0 &&
+            (p_test->bench->iterations == 0 ||
+             p_test->bench->iterations > TEST_BENCH_MAX_ITERATIONS)) {
+            print_error("TEST_SUITE_ERR_INVALID_TEST_DATA!");
+            return TEST_SUITE_ERR_INVALID_TEST_DATA;
+        }
+
+        if (is_test_selected(filter, test_suite->name, p_test->name)) {
+            (*selected_tests)++;
+        }
+    }
+
+    return TEST_SUITE_ERR_NO_ERROR;
+}
+
+static void execute_test(uint32_t suite_id, struct test_t *p_test,
+                         struct test_result_t *ret, const char *time_unit)
+{
+    uint32_t start;
+
+    /* Sets the default value before the test */
+    ret->val = TEST_PASSED;
+
+    start = test_framework_get_timestamp();
+    if (p_test->bench != 0) {
+        run_bench(suite_id, p_test, ret, time_unit);
+    } else {
+        p_test->test(ret);
+    }
+    p_test->elapsed = test_framework_get_timestamp() - start;
+}
+
+static uint32_t report_testsuite_start(const struct test_suite_t *test_suite,
+                                       uint32_t selected_tests)
+{
+#ifdef TEST_FRAMEWORK_RESULT_STREAM
+    return test_stream_suite_start(test_suite, selected_tests);
+#else
+    (void)selected_tests;
+
+    printf_set_color(YELLOW);
+    TEST_LOG("Running Test Suite %s...\r\n", test_suite->name);
+
+    return 0;
+#endif
+}
+
+static void report_test_start(const struct test_t *p_test)
+{
+#ifndef TEST_FRAMEWORK_RESULT_STREAM
+    printf_set_color(DEFAULT);
+    TEST_LOG("> Executing '%s' \r\n  Description: '%s'\r\n",
+             p_test->name, p_test->desc);
+#endif
+}
+
+static void report_test_result(uint32_t suite_id, const struct test_t *p_test,
+                               const struct test_result_t *ret)
+{
+#ifdef TEST_FRAMEWORK_RESULT_STREAM
+    test_stream_test_result(suite_id, p_test, ret);
+#else
+    if (ret->val == TEST_FAILED) {
+        test_failed(ret, p_test->name);
+    } else if (ret->val == TEST_SKIPPED) {
+        printf_set_color(DEFAULT);
+        TEST_LOG("  TEST: %s - SKIPPED!\r\n", p_test->name);
+    } else {
+        printf_set_color(GREEN);
+        TEST_LOG("  TEST: %s - PASSED!\r\n", p_test->name);
+    }
+#endif
+}
+
+/* Reports the end of the test suite and sets its result */
+static void report_testsuite_end(uint32_t suite_id,
+                                 struct test_suite_t *test_suite,
+                                 uint32_t failed_tests, uint32_t skipped_tests,
+                                 uint32_t selected_tests,
+                                 const struct test_t *p_slowest,
+                                 const char *time_unit)
+{
+    test_suite->val = (failed_tests == 0) ? TEST_PASSED : TEST_FAILED;
+
+#ifdef TEST_FRAMEWORK_RESULT_STREAM
+    test_stream_suite_end(suite_id, test_suite, failed_tests, skipped_tests);
+#else
+    if (time_unit != NULL) {
+        printf_set_color(DEFAULT);
+        TEST_LOG("Test suite elapsed time: %u %s\r\n",
+                 test_suite->elapsed, time_unit);
+        TEST_LOG("Slowest test: %s (%u %s)\r\n",
+                 p_slowest->name, p_slowest->elapsed, time_unit);
+    }
+
+    if (failed_tests != 0) {
+        printf_set_color(DEFAULT);
+        TEST_LOG("Number of failed tests: %d of %d\r\n",
+                 failed_tests, selected_tests);
+    }
+    if (skipped_tests != 0) {
+        printf_set_color(DEFAULT);
+        TEST_LOG("Number of skipped tests: %d of %d\r\n",
+                 skipped_tests, selected_tests);
+    }
+
+    if (failed_tests == 0) {
+        printf_set_color(GREEN);
+        TEST_LOG("TESTSUITE PASSED!\r\n");
+    } else {
+        printf_set_color(RED);
+        TEST_LOG("TESTSUITE FAILED!\r\n");
+    }
+#endif /* TEST_FRAMEWORK_RESULT_STREAM */
+
+    /* Outputs the messages of the test suite if logging is deferred */
+    TEST_LOG_FLUSH();
+}
+
+/*
+ * Runs the selected tests of a test suite registered by prepare_testsuite() on
+ * the calling thread and reports them as they complete.
+ */
+static void run_prepared_testsuite(struct test_suite_t *test_suite,
+                                   const char *filter, uint32_t selected_tests)
+{
+    uint32_t failed_tests = 0;
+    uint32_t skipped_tests = 0;
+    uint32_t i, suite_start, suite_id;
+    struct test_t *p_test;
+    const struct test_t *p_slowest = NULL;
+    const char *time_unit = test_framework_get_timestamp_unit();
+    /* Suppress false positive IAR warning Pe188 (enumerated type mixed with another type) */
+#if defined(__ICCARM__)
+#pragma diag_suppress = Pe188
+#endif
+    struct test_result_t ret = {0};
+#if defined(__ICCARM__)
+#pragma diag_default = Pe188
+#endif
+
+    suite_id = report_testsuite_start(test_suite, selected_tests);
+
+    suite_start = test_framework_get_timestamp();
+
+    for (i = 0; i < test_suite->list_size; i++) {
+        p_test = &test_suite->test_list[i];
+        if (!is_test_selected(filter, test_suite->name, p_test->name)) {
+            continue;
+        }
+
+        report_test_start(p_test);
+
+        /* Executes the test */
+        execute_test(suite_id, p_test, &ret, time_unit);
+
+        report_test_result(suite_id, p_test, &ret);
+
+        if (ret.val == TEST_FAILED) {
+            failed_tests++;
+        } else if (ret.val == TEST_SKIPPED) {
+            skipped_tests++;
+        }
+
+        if ((p_slowest == NULL) || (p_test->elapsed > p_slowest->elapsed)) {
+            p_slowest = p_test;
+        }
+    }
+
+    test_suite->elapsed = test_framework_get_timestamp() - suite_start;
+
+    if (test_suite->cleanup != NULL) {
+        test_suite->cleanup();
+    }
+
+    report_testsuite_end(suite_id, test_suite, failed_tests, skipped_tests,
+                         selected_tests, p_slowest, time_unit);
+}
+
+#ifdef TEST_FRAMEWORK_PARALLEL
+static bool is_testsuite_serial(const struct test_suite_t *test_suite)
+{
+    uint32_t i;
+
+    if ((test_suite->flags & TEST_SUITE_FLAG_SERIAL) != 0) {
+        return true;
+    }
+
+    /* Benchmarks share the sample buffer and need an otherwise idle system */
+    for (i = 0; i < test_suite->list_size; i++) {
+        if (test_suite->test_list[i].bench != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Runs the selected tests of a test suite on a worker thread. The results are
+ * kept in the test list until the test suite is reported.
+ */
+static void execute_testsuite(void *arg)
+{
+    struct test_suite_t *test_suite = arg;
+    const char *filter = get_test_filter();
+    struct test_t *p_test;
+    uint32_t i, suite_start;
+
+    suite_start = test_framework_get_timestamp();
+
+    for (i = 0; i < test_suite->list_size; i++) {
+        p_test = &test_suite->test_list[i];
+        if (is_test_selected(filter, test_suite->name, p_test->name)) {
+            execute_test(0, p_test, &p_test->ret, NULL);
+        }
+    }
+
+    test_suite->elapsed = test_framework_get_timestamp() - suite_start;
+
+    if (test_suite->cleanup != NULL) {
+        test_suite->cleanup();
+    }
+}
+
+/* Reports the results of a test suite run by \ref execute_testsuite */
+static void report_testsuite(struct test_suite_t *test_suite,
+                             const char *filter, const char *time_unit)
+{
+    uint32_t failed_tests = 0;
+    uint32_t skipped_tests = 0;
+    uint32_t selected_tests = 0;
+    uint32_t i, suite_id;
+    const struct test_t *p_test;
+    const struct test_t *p_slowest = NULL;
+
+    for (i = 0; i < test_suite->list_size; i++) {
+        p_test = &test_suite->test_list[i];
+        if (is_test_selected(filter, test_suite->name, p_test->name)) {
+            selected_tests++;
+        }
+    }
+
+    suite_id = report_testsuite_start(test_suite, selected_tests);
+
+    for (i = 0; i < test_suite->list_size; i++) {
+        p_test = &test_suite->test_list[i];
+        if (!is_test_selected(filter, test_suite->name, p_test->name)) {
+            continue;
+        }
+
+        report_test_start(p_test);
+        report_test_result(suite_id, p_test, &p_test->ret);
+
+        if (p_test->ret.val == TEST_FAILED) {
+            failed_tests++;
+        } else if (p_test->ret.val == TEST_SKIPPED) {
+            skipped_tests++;
+        }
+
+        if ((p_slowest == NULL) || (p_test->elapsed > p_slowest->elapsed)) {
+            p_slowest = p_test;
+        }
+    }
+
+    report_testsuite_end(suite_id, test_suite, failed_tests, skipped_tests,
+                         selected_tests, p_slowest, time_unit);
+}
+
+/*
+ * Runs consecutive test suites concurrently on worker threads, up to the next
+ * serial-only test suite. That one is run alone on the calling thread once the
+ * previous ones are complete. Results are reported in the order of the list.
+ */
+static enum test_suite_err_t run_testsuites_parallel(
+                                            struct test_suite_t test_suites[],
+                                            const char *filter,
+                                            const char *time_unit)
+{
+    enum test_suite_err_t retval = TEST_SUITE_ERR_NO_ERROR;
+    uint32_t i = 0, first, selected_tests = 0;
+    bool workers;
+
+    while (test_suites[i].freg != NULL) {
+        first = i;
+
+        workers = test_parallel_begin(&execute_testsuite);
+        if (!workers) {
+            print_error("No test worker, test suites run one at a time");
+        }
+
+        for (; test_suites[i].freg != NULL; i++) {
+            retval = prepare_testsuite(&test_suites[i], filter,
+                                       &selected_tests);
+            if (retval != TEST_SUITE_ERR_NO_ERROR) {
+                break;
+            }
+
+            if (selected_tests == 0) {
+                test_suites[i].val = TEST_SKIPPED;
+                test_suites[i].elapsed = 0;
+                continue;
+            }
+
+            if (is_testsuite_serial(&test_suites[i])) {
+                break;
+            }
+
+            /* Placeholder until the test suite is reported */
+            test_suites[i].val = TEST_PASSED;
+            if (!test_parallel_dispatch(&test_suites[i]) && workers) {
+                print_error("Test worker not created, test suite run alone");
+            }
+        }
+        /* Waits for all the dispatched test suites to complete */
+        test_parallel_end();
+
+        if (retval != TEST_SUITE_ERR_NO_ERROR) {
+            return retval;
+        }
+
+        for (; first < i; first++) {
+            if (test_suites[first].val != TEST_SKIPPED) {
+                report_testsuite(&test_suites[first], filter, time_unit);
+            }
+        }
+
+        /* The serial test suite is already registered */
+        if (test_suites[i].freg != NULL) {
+            run_prepared_testsuite(&test_suites[i], filter, selected_tests);
+            i++;
+        }
+    }
+
+    return TEST_SUITE_ERR_NO_ERROR;
+}
+#endif /* TEST_FRAMEWORK_PARALLEL */
+
 enum test_suite_err_t run_test(const char *suite_type, struct test_suite_t test_suites[])
 {
     uint32_t i;
     enum test_suite_err_t retval = TEST_SUITE_ERR_NO_ERROR;
+    const char *time_unit = test_framework_get_timestamp_unit();
+    const char *filter = get_test_filter();
 
+#ifdef TEST_FRAMEWORK_RESULT_STREAM
+    test_stream_run_start(suite_type, time_unit, filter);
+#else
     printf_set_color(YELLOW);
     TEST_LOG("\r\n#### Execute test suites for the %s area ####\r\n",
              suite_type);
+    if (*filter != '\0') {
+        printf_set_color(DEFAULT);
+        TEST_LOG("Test filter: %s\r\n", filter);
+    }
+#endif
 
     /* Executes test suites */
+#ifdef TEST_FRAMEWORK_PARALLEL
+    retval = run_testsuites_parallel(test_suites, filter, time_unit);
+    if (retval != TEST_SUITE_ERR_NO_ERROR) {
+        /* End function execution */
+        return retval;
+    }
+#else
     for (i = 0; test_suites[i].freg != NULL; i++) {
         retval = run_testsuite(&test_suites[i]);
         if (retval != TEST_SUITE_ERR_NO_ERROR) {
@@ -69,26 +650,50 @@ enum test_suite_err_t run_test(const char *suite_type, struct test_suite_t test_
             return retval;
         }
     }
+#endif
+
+#ifdef TEST_FRAMEWORK_RESULT_STREAM
+    for (i = 0; test_suites[i].freg != NULL; i++) {
+        if (test_suites[i].val == TEST_FAILED) {
+            retval = TEST_SUITE_ERR_TEST_FAILED;
+        }
+    }
 
+    test_stream_run_end(suite_type,
+                        (retval == TEST_SUITE_ERR_NO_ERROR) ?
+                        TEST_PASSED : TEST_FAILED);
+#else
     /* Prints test suites summary */
     printf_set_color(YELLOW);
     TEST_LOG("\r\n*** %s test suites summary ***\r\n", suite_type);
     for (i = 0; test_suites[i].freg != NULL; i++) {
+        if (test_suites[i].val == TEST_SKIPPED) {
+            /* None of the tests of the suite is selected by the filter */
+            continue;
+        }
+
         printf_set_color(DEFAULT);
         TEST_LOG("Test suite '%s' has", test_suites[i].name);
         if (test_suites[i].val == TEST_PASSED) {
             printf_set_color(GREEN);
-            TEST_LOG(" PASSED\r\n");
+            TEST_LOG(" PASSED");
         } else {
             printf_set_color(RED);
-            TEST_LOG(" FAILED\r\n");
+            TEST_LOG(" FAILED");
             retval = TEST_SUITE_ERR_TEST_FAILED;
         }
+
+        if (time_unit != NULL) {
+            printf_set_color(DEFAULT);
+            TEST_LOG(" (%u %s)", test_suites[i].elapsed, time_unit);
+        }
+        TEST_LOG("\r\n");
     }
 
     printf_set_color(YELLOW);
     TEST_LOG("\r\n*** End of %s test suites ***\r\n", suite_type);
     printf_set_color(DEFAULT);
+#endif /* TEST_FRAMEWORK_RESULT_STREAM */
 
     return retval;
 }
@@ -109,6 +714,11 @@ enum test_suite_err_t set_testsuite(const char *name,
     return TEST_SUITE_ERR_NO_ERROR;
 }
 
+void set_test_filter(const char *filter)
+{
+    test_filter = filter;
+}
+
 void set_test_failed(const char *info_msg, const char *filename, uint32_t line,
                      struct test_result_t *ret)
 {
@@ -125,89 +735,23 @@ void set_test_failed(const char *info_msg, const char *filename, uint32_t line,
 
 enum test_suite_err_t run_testsuite(struct test_suite_t *test_suite)
 {
-    uint32_t failed_tests = 0;
-    uint32_t skipped_tests = 0;
-    uint32_t i;
-    struct test_t *p_test;
-    /* Suppress false positive IAR warning Pe188 (enumerated type mixed with another type) */
-#if defined(__ICCARM__)
-#pragma diag_suppress = Pe188
-#endif
-    struct test_result_t ret = {0};
-#if defined(__ICCARM__)
-#pragma diag_default = Pe188
-#endif
+    uint32_t selected_tests = 0;
+    const char *filter = get_test_filter();
+    enum test_suite_err_t retval;
 
-    if (test_suite == 0 || test_suite->freg == 0) {
-        print_error("TEST_SUITE_ERR_INVALID_DATA!");
-        return TEST_SUITE_ERR_INVALID_DATA;
+    retval = prepare_testsuite(test_suite, filter, &selected_tests);
+    if (retval != TEST_SUITE_ERR_NO_ERROR) {
+        return retval;
     }
 
-    /* Sets test suite parameters */
-    test_suite->freg(test_suite);
-    if (test_suite->name == 0 || test_suite->list_size == 0) {
-        print_error("TEST_SUITE_ERR_INVALID_DATA!");
-        return TEST_SUITE_ERR_INVALID_DATA;
+    if (selected_tests == 0) {
+        /* Nothing to run, the suite is left out of the results */
+        test_suite->val = TEST_SKIPPED;
+        test_suite->elapsed = 0;
+        return TEST_SUITE_ERR_NO_ERROR;
     }
 
-    printf_set_color(YELLOW);
-    TEST_LOG("Running Test Suite %s...\r\n", test_suite->name);
-
-    /* Sets pointer to the first test */
-    p_test = test_suite->test_list;
-
-    for (i = 0; i < test_suite->list_size; i++) {
-
-        if (p_test->test == 0 || p_test->name == 0) {
-            print_error("TEST_SUITE_ERR_INVALID_TEST_DATA!");
-            return TEST_SUITE_ERR_INVALID_TEST_DATA;
-        }
-
-        printf_set_color(DEFAULT);
-        TEST_LOG("> Executing '%s' \r\n  Description: '%s'\r\n",
-                 p_test->name, p_test->desc);
-
-        /* Sets the default value before the test */
-        ret.val = TEST_PASSED;
-
-        /* Executes the test */
-        p_test->test(&ret);
-        if (ret.val == TEST_FAILED) {
-            test_failed(&ret, p_test->name);
-            failed_tests++;
-        } else if (ret.val == TEST_SKIPPED) {
-            printf_set_color(DEFAULT);
-            TEST_LOG("  TEST: %s - SKIPPED!\r\n", p_test->name);
-            skipped_tests++;
-        } else {
-            printf_set_color(GREEN);
-            TEST_LOG("  TEST: %s - PASSED!\r\n", p_test->name);
-        }
-
-        /* Sets pointer to the next test */
-        p_test++;
-    }
-
-    if (failed_tests != 0) {
-        printf_set_color(DEFAULT);
-        TEST_LOG("Number of failed tests: %d of %d\r\n",
-                 failed_tests, test_suite->list_size);
-    }
-    if (skipped_tests != 0) {
-        printf_set_color(DEFAULT);
-        TEST_LOG("Number of skipped tests: %d of %d\r\n",
-                 skipped_tests, test_suite->list_size);
-    }
-
-    if (failed_tests == 0) {
-        printf_set_color(GREEN);
-        TEST_LOG("TESTSUITE PASSED!\r\n");
-        test_suite->val = TEST_PASSED;
-    } else {
-        printf_set_color(RED);
-        TEST_LOG("TESTSUITE FAILED!\r\n");
-        test_suite->val = TEST_FAILED;
-    }
+    run_prepared_testsuite(test_suite, filter, selected_tests);
 
     return TEST_SUITE_ERR_NO_ERROR;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -41,14 +41,43 @@ struct test_result_t {
  */
 typedef void TEST_FUN(struct test_result_t *ret);
 
+/* Max number of timed iterations of a benchmark test */
+#ifndef TEST_BENCH_MAX_ITERATIONS
+#define TEST_BENCH_MAX_ITERATIONS      64
+#endif
+
+struct test_bench_t {
+    uint32_t iterations;           /*!< Number of timed iterations, up to
+                                    *   \ref TEST_BENCH_MAX_ITERATIONS
+                                    */
+    uint32_t warmup;               /*!< Number of untimed warm-up iterations */
+    uint32_t bytes;                /*!< Bytes processed by each iteration, used
+                                    *   to report throughput. 0 if not
+                                    *   applicable
+                                    */
+};
+
 struct test_t {
     TEST_FUN * const test;         /*!< Test function to call */
     const char *name;              /*!< Test name */
     const char *desc;              /*!< Test description */
+    const struct test_bench_t *bench; /*!< Benchmark parameters. NULL to run
+                                       *   the test function once
+                                       */
+    uint32_t elapsed;              /*!< Execution time of the last run, in
+                                    *   \ref test_framework_get_timestamp_unit
+                                    */
+    struct test_result_t ret;      /*!< Result of the last run, kept until the
+                                    *   test suite is reported when it is run
+                                    *   on a worker thread
+                                    */
 };
 
 struct test_suite_t;
 
+/* The test suite must not run concurrently with any other test suite */
+#define TEST_SUITE_FLAG_SERIAL         (1UL << 0)
+
 /**
  * \brief Registers test in the testsuite structure and sets the name.
  *
@@ -56,6 +85,12 @@ struct test_suite_t;
  */
 typedef void TESTSUITE_REG(struct test_suite_t *p_test_suite);
 
+/**
+ * \brief Releases the resources kept by the tests of a test suite, such as
+ *        their worker threads, once they are all complete.
+ */
+typedef void TESTSUITE_CLEANUP(void);
+
 struct test_suite_t {
     TESTSUITE_REG * const freg;     /*!< Function to set all follow fields
                                      *   of the current test suite
@@ -64,6 +99,15 @@ struct test_suite_t {
     uint32_t list_size;            /*!< List size */
     const char *name;              /*!< Test suite name */
     enum test_status_t val;        /*!< Test suite result \ref test_result_t */
+    uint32_t elapsed;              /*!< Execution time of the whole test suite,
+                                    *   in \ref test_framework_get_timestamp_unit
+                                    */
+    uint32_t flags;                /*!< Isolation requirements of the test
+                                    *   suite, TEST_SUITE_FLAG_*
+                                    */
+    TESTSUITE_CLEANUP *cleanup;    /*!< Optional function called after the
+                                    *   tests of the suite, set by freg
+                                    */
 };
 
 /**
@@ -101,6 +145,32 @@ enum test_suite_err_t set_testsuite(const char *name,
                                     struct test_t *test_list, uint32_t size,
                                     struct test_suite_t *p_ts);
 
+/* Max length of the test filter, including the NUL terminator */
+#ifndef TEST_FILTER_MAX_LEN
+#define TEST_FILTER_MAX_LEN            128
+#endif
+
+/**
+ * \brief Default test filter applied when \ref set_test_filter is not called.
+ *
+ * \details Initialized from TEST_FRAMEWORK_FILTER at build time. It can be
+ *          overwritten in memory, for example by a debugger or a model, before
+ *          the tests start, to select tests without rebuilding.
+ */
+extern volatile char test_framework_filter[TEST_FILTER_MAX_LEN];
+
+/**
+ * \brief Selects the tests to be run.
+ *
+ * \param[in] filter  Comma-separated list of glob patterns. '*' matches any
+ *                    sequence of characters and '?' any single character.
+ *                    A test is run if any pattern matches its name or the name
+ *                    of its test suite. NULL or "" runs all the tests.
+ *
+ * \note The filter string is not copied and must stay valid while tests run.
+ */
+void set_test_filter(const char *filter);
+
 /**
  * \brief Runs the given test suite.
  *
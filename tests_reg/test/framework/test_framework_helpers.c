@@ -1,13 +1,97 @@
 /*
- * Copyright (c) 2017-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
+#include <stddef.h>
+
 #include "test_framework_helpers.h"
 
+#if defined(CONFIG_TFM_ERPC_TEST_FRAMEWORK)
+#include <time.h>
+#elif defined(DOMAIN_NS) && !defined(TEST_FRAMEWORK_DWT_TIMESTAMP)
+#include "os_wrapper/tick.h"
+#endif
+
+#ifdef TEST_FRAMEWORK_DWT_TIMESTAMP
+/* Armv7-M/Armv8-M Mainline debug registers used for cycle counting */
+#define DEMCR_ADDR              0xE000EDFCUL
+#define DEMCR_TRCENA            (1UL << 24)
+#define DWT_CTRL_ADDR           0xE0001000UL
+#define DWT_CTRL_CYCCNTENA      (1UL << 0)
+#define DWT_CTRL_NOCYCCNT       (1UL << 25)
+#define DWT_CYCCNT_ADDR         0xE0001004UL
+
+#define REG32(addr)             (*(volatile uint32_t *)(addr))
+#endif
+
 void printf_set_color(enum serial_color_t color_id)
 {
+#ifdef TEST_FRAMEWORK_RESULT_STREAM
+    /* Keep the result stream free of escape sequences */
+    (void)color_id;
+#else
     TEST_LOG("\33[%dm", color_id);
+#endif
+}
+
+#if defined(CONFIG_TFM_ERPC_TEST_FRAMEWORK)
+__attribute__((weak)) uint32_t test_framework_get_timestamp(void)
+{
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) {
+        return 0;
+    }
+
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000UL + ts.tv_nsec / 1000);
+}
+
+__attribute__((weak)) const char *test_framework_get_timestamp_unit(void)
+{
+    return "us";
+}
+#elif defined(TEST_FRAMEWORK_DWT_TIMESTAMP)
+__attribute__((weak)) uint32_t test_framework_get_timestamp(void)
+{
+    if (REG32(DWT_CTRL_ADDR) & DWT_CTRL_NOCYCCNT) {
+        return 0;
+    }
+
+    /* Start the cycle counter on first use */
+    if (!(REG32(DWT_CTRL_ADDR) & DWT_CTRL_CYCCNTENA)) {
+        REG32(DEMCR_ADDR) |= DEMCR_TRCENA;
+        REG32(DWT_CYCCNT_ADDR) = 0;
+        REG32(DWT_CTRL_ADDR) |= DWT_CTRL_CYCCNTENA;
+    }
+
+    return REG32(DWT_CYCCNT_ADDR);
+}
+
+__attribute__((weak)) const char *test_framework_get_timestamp_unit(void)
+{
+    return "cycles";
+}
+#elif defined(DOMAIN_NS)
+__attribute__((weak)) uint32_t test_framework_get_timestamp(void)
+{
+    return os_wrapper_get_tick();
+}
+
+__attribute__((weak)) const char *test_framework_get_timestamp_unit(void)
+{
+    return "ticks";
+}
+#else
+__attribute__((weak)) uint32_t test_framework_get_timestamp(void)
+{
+    return 0;
+}
+
+__attribute__((weak)) const char *test_framework_get_timestamp_unit(void)
+{
+    return NULL;
 }
+#endif
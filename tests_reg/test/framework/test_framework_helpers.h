@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -36,6 +36,26 @@ enum serial_color_t {
  */
 void printf_set_color(enum serial_color_t color_id);
 
+/**
+ * \brief Gets the current timestamp used to measure test execution time.
+ *
+ * \details The timestamp source is selected at build time: the host clock on
+ *          the eRPC test framework, the DWT cycle counter if
+ *          TEST_FRAMEWORK_DWT_TIMESTAMP is set, or the RTOS tick count on the
+ *          NS side. Platforms can override it with their own timer.
+ *
+ * \return The current timestamp. 0 if no timestamp source is available.
+ */
+uint32_t test_framework_get_timestamp(void);
+
+/**
+ * \brief Gets the unit of the values returned by
+ *        \ref test_framework_get_timestamp.
+ *
+ * \return The unit as a string, or NULL if no timestamp source is available.
+ */
+const char *test_framework_get_timestamp_unit(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "test_framework_parallel.h"
+#include "os_wrapper/semaphore.h"
+#include "os_wrapper/thread.h"
+
+#define TEST_WORKER_NAME        "test_worker"
+
+/* Counts the workers available to run a job */
+static void *free_workers;
+static test_parallel_job_t *batch_job;
+static uint32_t worker_priority;
+
+static void worker_thread(void *arg)
+{
+    batch_job(arg);
+
+    /* Hand the worker back to the dispatcher */
+    os_wrapper_semaphore_release(free_workers);
+
+    os_wrapper_thread_exit();
+}
+
+bool test_parallel_begin(test_parallel_job_t *job)
+{
+    void *current_thread_handle;
+
+    batch_job = job;
+
+    /* Workers run at the priority of the dispatcher */
+    current_thread_handle = os_wrapper_thread_get_handle();
+    if ((current_thread_handle == NULL) ||
+        (os_wrapper_thread_get_priority(current_thread_handle,
+                                        &worker_priority) ==
+         OS_WRAPPER_ERROR)) {
+        free_workers = NULL;
+        return false;
+    }
+
+    free_workers = os_wrapper_semaphore_create(TEST_FRAMEWORK_PARALLEL_WORKERS,
+                                               TEST_FRAMEWORK_PARALLEL_WORKERS,
+                                               "test_workers");
+
+    return free_workers != NULL;
+}
+
+bool test_parallel_dispatch(void *arg)
+{
+    void *thread;
+
+    if ((free_workers == NULL) ||
+        (os_wrapper_semaphore_acquire(free_workers, OS_WRAPPER_WAIT_FOREVER) !=
+         OS_WRAPPER_SUCCESS)) {
+        batch_job(arg);
+        return false;
+    }
+
+    thread = os_wrapper_thread_new(TEST_WORKER_NAME,
+                                   TEST_FRAMEWORK_PARALLEL_STACK_SIZE,
+                                   worker_thread, arg, worker_priority);
+    if (thread == NULL) {
+        os_wrapper_semaphore_release(free_workers);
+        batch_job(arg);
+        return false;
+    }
+
+    return true;
+}
+
+void test_parallel_end(void)
+{
+    uint32_t i;
+
+    if (free_workers == NULL) {
+        return;
+    }
+
+    /* All the workers are back once all the jobs are complete */
+    for (i = 0; i < TEST_FRAMEWORK_PARALLEL_WORKERS; i++) {
+        os_wrapper_semaphore_acquire(free_workers, OS_WRAPPER_WAIT_FOREVER);
+    }
+
+    os_wrapper_semaphore_delete(free_workers);
+    free_workers = NULL;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TEST_FRAMEWORK_PARALLEL_H__
+#define __TEST_FRAMEWORK_PARALLEL_H__
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max number of jobs run concurrently */
+#ifndef TEST_FRAMEWORK_PARALLEL_WORKERS
+#define TEST_FRAMEWORK_PARALLEL_WORKERS        2
+#endif
+
+/*
+ * Stack size of the worker threads. The workers are allocated from the RTOS
+ * heap next to the test thread, which must have room for all of them.
+ */
+#ifndef TEST_FRAMEWORK_PARALLEL_STACK_SIZE
+#define TEST_FRAMEWORK_PARALLEL_STACK_SIZE     0x800
+#endif
+
+/**
+ * \brief Job run on a worker thread.
+ *
+ * \param[in,out] arg  Argument passed to \ref test_parallel_dispatch
+ */
+typedef void test_parallel_job_t(void *arg);
+
+/**
+ * \brief Starts a batch of jobs.
+ *
+ * \param[in] job  Function run by each job of the batch
+ *
+ * \return true if the jobs can be run on worker threads, false if they are
+ *         run on the calling thread instead.
+ */
+bool test_parallel_begin(test_parallel_job_t *job);
+
+/**
+ * \brief Runs a job of the current batch on a worker thread.
+ *
+ * \details Blocks until a worker is available.
+ *
+ * \param[in,out] arg  Argument of the job
+ *
+ * \return true if the job is run on a worker thread, false if it has been run
+ *         on the calling thread because no worker could be created.
+ */
+bool test_parallel_dispatch(void *arg);
+
+/**
+ * \brief Waits for all the jobs of the current batch to complete.
+ */
+void test_parallel_end(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TEST_FRAMEWORK_PARALLEL_H__ */
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stddef.h>
+
+#include "test_framework_stream.h"
+#ifdef TEST_FRAMEWORK_PARALLEL
+#include "os_wrapper/mutex.h"
+#endif
+
+/*
+ * Max length of a record, and of each string in it once escaped. The longest
+ * record, the result of a failed test, holds three strings and fits.
+ */
+#define STREAM_RECORD_MAX_LEN   512
+#define STREAM_STRING_MAX_LEN   96
+
+/*
+ * Record being formatted. It is output with a single call once complete, so
+ * that the messages printed by the tests cannot be mixed into it.
+ */
+struct stream_record_t {
+    char buf[STREAM_RECORD_MAX_LEN];
+    size_t len;
+};
+
+/* ID assigned to the next test suite of the current run */
+static uint32_t next_suite_id;
+
+/* Only accessed with the record lock held */
+static struct stream_record_t record;
+
+#ifdef TEST_FRAMEWORK_PARALLEL
+/*
+ * Record lock. The test workers emit records too, such as the errors of the
+ * tests, while the dispatcher reports the test suites.
+ */
+static void *record_mutex;
+#endif
+
+static const char *status_to_str(enum test_status_t val)
+{
+    switch (val) {
+    case TEST_PASSED:
+        return "PASSED";
+    case TEST_FAILED:
+        return "FAILED";
+    case TEST_SKIPPED:
+        return "SKIPPED";
+    }
+
+    return "UNKNOWN";
+}
+
+/* Appends a character, dropped if the record is full */
+static void record_char(char c)
+{
+    if (record.len < STREAM_RECORD_MAX_LEN - 1) {
+        record.buf[record.len++] = c;
+    }
+}
+
+static void record_text(const char *str)
+{
+    for (; *str != '\0'; str++) {
+        record_char(*str);
+    }
+}
+
+/* Starts a record of the given type, with the record lock held */
+static void record_start(const char *ev)
+{
+#ifdef TEST_FRAMEWORK_PARALLEL
+    if (record_mutex != NULL) {
+        (void)os_wrapper_mutex_acquire(record_mutex, OS_WRAPPER_WAIT_FOREVER);
+    }
+#endif
+
+    record.len = 0;
+    record_text(TEST_STREAM_PREFIX "{\"ev\":\"");
+    record_text(ev);
+    record_text("\"");
+}
+
+/*
+ * Appends a string as a JSON string. Quotes and backslashes are escaped and
+ * control characters, such as the line endings of failure messages, dropped.
+ * The string is cut if longer than STREAM_STRING_MAX_LEN once escaped.
+ */
+static void record_string(const char *str)
+{
+    size_t end;
+
+    record_char('"');
+    end = record.len + STREAM_STRING_MAX_LEN;
+
+    for (; *str != '\0'; str++) {
+        if ((*str == '"') || (*str == '\\')) {
+            if (record.len + 2 > end) {
+                break;
+            }
+            record_char('\\');
+            record_char(*str);
+        } else if ((unsigned char)*str >= ' ') {
+            if (record.len + 1 > end) {
+                break;
+            }
+            record_char(*str);
+        }
+    }
+
+    record_char('"');
+}
+
+/* Appends a member with a string value */
+static void record_member_string(const char *name, const char *str)
+{
+    record_text(",\"");
+    record_text(name);
+    record_text("\":");
+    record_string(str);
+}
+
+/* Appends a member with an unsigned value */
+static void record_member_uint(const char *name, uint32_t val)
+{
+    char digits[10];
+    uint32_t i = 0;
+
+    record_text(",\"");
+    record_text(name);
+    record_text("\":");
+
+    do {
+        digits[i++] = (char)('0' + (val % 10));
+        val /= 10;
+    } while (val != 0);
+
+    while (i > 0) {
+        record_char(digits[--i]);
+    }
+}
+
+/* Ends the record, outputs it and releases the record lock */
+static void record_end(void)
+{
+    record_text("}\r\n");
+    record.buf[record.len] = '\0';
+
+    TEST_LOG("%s", record.buf);
+
+#ifdef TEST_FRAMEWORK_PARALLEL
+    if (record_mutex != NULL) {
+        (void)os_wrapper_mutex_release(record_mutex);
+    }
+#endif
+}
+
+void test_stream_run_start(const char *suite_type, const char *time_unit,
+                           const char *filter)
+{
+#ifdef TEST_FRAMEWORK_PARALLEL
+    /* Created before any worker is started, and kept for the next runs */
+    if (record_mutex == NULL) {
+        record_mutex = os_wrapper_mutex_create();
+    }
+#endif
+
+    next_suite_id = 0;
+
+    record_start("run");
+    record_member_string("type", suite_type);
+    if (time_unit != NULL) {
+        record_member_string("unit", time_unit);
+    }
+    if (filter != NULL && *filter != '\0') {
+        record_member_string("filter", filter);
+    }
+    record_end();
+}
+
+void test_stream_run_end(const char *suite_type, enum test_status_t val)
+{
+    record_start("end");
+    record_member_string("type", suite_type);
+    record_member_string("status", status_to_str(val));
+    record_end();
+}
+
+uint32_t test_stream_suite_start(const struct test_suite_t *ts,
+                                 uint32_t selected_tests)
+{
+    uint32_t suite_id = next_suite_id++;
+
+    record_start("suite");
+    record_member_uint("suite", suite_id);
+    record_member_string("name", ts->name);
+    record_member_uint("tests", selected_tests);
+    record_end();
+
+    return suite_id;
+}
+
+void test_stream_suite_end(uint32_t suite_id, const struct test_suite_t *ts,
+                           uint32_t failed, uint32_t skipped)
+{
+    record_start("suite_end");
+    record_member_uint("suite", suite_id);
+    record_member_string("status", status_to_str(ts->val));
+    record_member_uint("failed", failed);
+    record_member_uint("skipped", skipped);
+    record_member_uint("elapsed", ts->elapsed);
+    record_end();
+}
+
+void test_stream_test_result(uint32_t suite_id, const struct test_t *p_test,
+                             const struct test_result_t *ret)
+{
+    record_start("test");
+    record_member_uint("suite", suite_id);
+    record_member_string("name", p_test->name);
+    record_member_string("status", status_to_str(ret->val));
+    record_member_uint("elapsed", p_test->elapsed);
+
+    if (ret->val == TEST_FAILED) {
+        if (ret->info_msg != 0) {
+            record_member_string("msg", ret->info_msg);
+        }
+        if (ret->filename != 0) {
+            record_member_string("file", ret->filename);
+            record_member_uint("line", ret->line);
+        }
+    }
+
+    record_end();
+}
+
+void test_stream_bench(uint32_t suite_id, const struct test_t *p_test,
+                       const uint32_t *samples, uint32_t mean)
+{
+    uint32_t count = p_test->bench->iterations;
+
+    record_start("bench");
+    record_member_uint("suite", suite_id);
+    record_member_string("name", p_test->name);
+    record_member_uint("iterations", count);
+    record_member_uint("warmup", p_test->bench->warmup);
+    record_member_uint("min", samples[0]);
+    record_member_uint("median", samples[(count - 1) / 2]);
+    record_member_uint("mean", mean);
+    record_member_uint("p99", samples[(count * 99 + 99) / 100 - 1]);
+    record_member_uint("max", samples[count - 1]);
+    record_member_uint("bytes", p_test->bench->bytes);
+    record_end();
+}
+
+void test_stream_error(const char *err_msg)
+{
+    record_start("error");
+    record_member_string("msg", err_msg);
+    record_end();
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TEST_FRAMEWORK_STREAM_H__
+#define __TEST_FRAMEWORK_STREAM_H__
+
+#include <stdint.h>
+#include "test_framework.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Machine-readable test result stream.
+ *
+ * Each record is a single line made of TEST_STREAM_PREFIX followed by a JSON
+ * object, so that it can be told apart from the log messages of the tests.
+ * A record is output whole with a single TEST_LOG() call, so that the messages
+ * of the tests running on other threads cannot be mixed into it.
+ * The "ev" member gives the record type: "run", "suite", "test", "bench",
+ * "suite_end", "end" or "error".
+ */
+#define TEST_STREAM_PREFIX      "@TR "
+
+/**
+ * \brief Emits the record starting a test run.
+ *
+ * \param[in] suite_type  The type of the suites in the run
+ * \param[in] time_unit   Unit of the elapsed times, or NULL if not measured
+ * \param[in] filter      Test filter of the run, "" if all tests are run
+ */
+void test_stream_run_start(const char *suite_type, const char *time_unit,
+                           const char *filter);
+
+/**
+ * \brief Emits the record ending a test run.
+ *
+ * \param[in] suite_type  The type of the suites in the run
+ * \param[in] val         Overall result of the run
+ */
+void test_stream_run_end(const char *suite_type, enum test_status_t val);
+
+/**
+ * \brief Emits the record starting a test suite.
+ *
+ * \param[in] ts              Test suite about to be run
+ * \param[in] selected_tests  Number of tests of the suite selected by the
+ *                            test filter
+ *
+ * \return The ID of the suite in the current run.
+ */
+uint32_t test_stream_suite_start(const struct test_suite_t *ts,
+                                 uint32_t selected_tests);
+
+/**
+ * \brief Emits the record ending a test suite.
+ *
+ * \param[in] suite_id  ID returned by \ref test_stream_suite_start
+ * \param[in] ts        Test suite which has been run
+ * \param[in] failed    Number of failed tests
+ * \param[in] skipped   Number of skipped tests
+ */
+void test_stream_suite_end(uint32_t suite_id, const struct test_suite_t *ts,
+                           uint32_t failed, uint32_t skipped);
+
+/**
+ * \brief Emits the result record of a test.
+ *
+ * \param[in] suite_id  ID returned by \ref test_stream_suite_start
+ * \param[in] p_test    Test which has been run
+ * \param[in] ret       Result of the test
+ */
+void test_stream_test_result(uint32_t suite_id, const struct test_t *p_test,
+                             const struct test_result_t *ret);
+
+/**
+ * \brief Emits the statistics record of a benchmark test.
+ *
+ * \param[in] suite_id  ID returned by \ref test_stream_suite_start
+ * \param[in] p_test    Benchmark test which has been run
+ * \param[in] samples   Sorted latency of each timed iteration
+ * \param[in] mean      Mean latency of the timed iterations
+ */
+void test_stream_bench(uint32_t suite_id, const struct test_t *p_test,
+                       const uint32_t *samples, uint32_t mean);
+
+/**
+ * \brief Emits an error record.
+ *
+ * \param[in] err_msg  Error message
+ */
+void test_stream_error(const char *err_msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TEST_FRAMEWORK_STREAM_H__ */
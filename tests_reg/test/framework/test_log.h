@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -22,8 +22,12 @@ extern "C" {
 
 #if defined USE_SP_LOG || USE_STDIO
 #define TEST_LOG(...) printf(__VA_ARGS__)
+#define TEST_LOG_FLUSH()
 #else
 #define TEST_LOG(...) tfm_log_printf(__VA_ARGS__)
+#define TEST_LOG_FLUSH() tfm_log_flush()
+/* tfm_log_printf() dumps buffers in hex with the %*ph format */
+#define TEST_LOG_HEX_DUMP
 #endif /* USE_SP_LOG */
 
 #ifdef __cplusplus
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited. All rights reserved.
  * Copyright (c) 2022, Cypress Semiconductor Corporation (an Infineon company)
  * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
@@ -57,8 +57,17 @@
 #ifdef EXTRA_NS_TEST_SUITE
 #include "extra_ns_tests.h"
 #endif
+#ifdef TEST_NS_PARALLEL_SELF_TEST
+#include "parallel_ns_tests.h"
+#endif
 
 static struct test_suite_t test_suites[] = {
+#ifdef TEST_NS_PARALLEL_SELF_TEST
+    /* Run first, together, to check that test suites run concurrently */
+    {&register_testsuite_ns_parallel_a, 0, 0, 0},
+    {&register_testsuite_ns_parallel_b, 0, 0, 0},
+#endif
+
     /* List test cases which are compliant with level 1 isolation */
 #ifdef TEST_NS_IPC
     /* Non-secure IPC test cases */
@@ -105,24 +114,29 @@ static struct test_suite_t test_suites[] = {
 
 #ifdef TEST_NS_FWU
     /* Non-secure Firmware Update test cases */
-    {&register_testsuite_ns_psa_fwu_interface, 0, 0, 0},
+    {&register_testsuite_ns_psa_fwu_interface, 0, 0, 0,
+     .flags = TEST_SUITE_FLAG_SERIAL},
 #endif
 
 #ifdef TEST_NS_MULTI_CORE
     /* Multi-core topology test cases */
-    {&register_testsuite_multi_core_ns_interface, 0, 0, 0},
+    {&register_testsuite_multi_core_ns_interface, 0, 0, 0,
+     .flags = TEST_SUITE_FLAG_SERIAL},
 #endif
 
 #ifdef TEST_NS_MANAGE_NSID
-    {&register_testsuite_nsid_test, 0, 0, 0},
+    {&register_testsuite_nsid_test, 0, 0, 0,
+     .flags = TEST_SUITE_FLAG_SERIAL},
 #endif /* TEST_NS_MANAGE_NSID */
 
 #if defined(TEST_NS_SLIH_IRQ) || defined(TEST_NS_FLIH_IRQ)
-    {&register_testsuite_irq_test, 0, 0, 0},
+    {&register_testsuite_irq_test, 0, 0, 0,
+     .flags = TEST_SUITE_FLAG_SERIAL},
 #endif
 
 #ifdef TEST_NS_FPU
-    {&register_testsuite_ns_fpu_interface, 0, 0, 0},
+    {&register_testsuite_ns_fpu_interface, 0, 0, 0,
+     .flags = TEST_SUITE_FLAG_SERIAL},
 #endif
 
     /* Run extra tests as last test suite, this way platform
@@ -130,7 +144,8 @@ static struct test_suite_t test_suites[] = {
      */
 #ifdef EXTRA_NS_TEST_SUITE
     /* Non-secure extra test cases */
-    {&register_testsuite_extra_ns_interface, 0, 0, 0},
+    {&register_testsuite_extra_ns_interface, 0, 0, 0,
+     .flags = TEST_SUITE_FLAG_SERIAL},
 #endif
 
     /* End of test suites */
@@ -2,7 +2,7 @@
  * attest_token_test.c
  *
  * Copyright (c) 2018-2019, Laurence Lundblade.
- * Copyright (c) 2020-2025, Arm Limited.
+ * Copyright (c) 2020-2026, Arm Limited.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -36,21 +36,35 @@
  */
 
 #ifdef DUMP_TOKEN
+#define DUMP_TOKEN_LINE_LEN 8
+
 static void dump_token(struct q_useful_buf_c *token)
 {
-    int i;
-    unsigned char num;
+    size_t i;
 
     TEST_LOG("\r\n");
-    TEST_LOG("########### token(len: %d): ###########\r\n", token->len);
+    TEST_LOG("########### token(len: %u): ###########\r\n",
+             (unsigned int)token->len);
+#ifdef TEST_LOG_HEX_DUMP
+    for (i = 0; i < token->len; i += DUMP_TOKEN_LINE_LEN) {
+        TEST_LOG(" %*ph\r\n",
+                 (int)(token->len - i < DUMP_TOKEN_LINE_LEN ?
+                       token->len - i : DUMP_TOKEN_LINE_LEN),
+                 (const uint8_t *)token->ptr + i);
+    }
+    TEST_LOG("############## token end  ##############\r\n");
+#else
+    unsigned char num;
+
     for (i = 0; i < token->len; ++i) {
         num = ((unsigned char *)token->ptr)[i];
         TEST_LOG(" 0x%X%X", (num & 0xF0) >> 4, num & 0x0F);
-        if (((i + 1) % 8) == 0) {
+        if (((i + 1) % DUMP_TOKEN_LINE_LEN) == 0) {
             TEST_LOG("\r\n");
         }
     }
     TEST_LOG("\r\n############## token end  ##############\r\n");
+#endif /* TEST_LOG_HEX_DUMP */
 }
 #endif /* DUMP_TOKEN */
 
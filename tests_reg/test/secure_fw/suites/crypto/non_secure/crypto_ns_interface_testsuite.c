@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -118,6 +118,15 @@ static void tfm_crypto_test_1054(struct test_result_t *ret);
 static void tfm_crypto_test_1055(struct test_result_t *ret);
 #endif /* TFM_CRYPTO_TEST_WP_SECP384_R1 */
 
+/* Length of the message hashed by psa_hash_test() */
+#define HASH_TEST_MSG_LEN   57
+
+static const struct test_bench_t hash_bench = {
+    .iterations = 16,
+    .warmup = 2,
+    .bytes = HASH_TEST_MSG_LEN,
+};
+
 static struct test_t crypto_tests[] = {
     {&tfm_crypto_test_1001, "TFM_NS_CRYPTO_TEST_1001",
      "Non Secure Key management interface"},
@@ -152,7 +161,7 @@ static struct test_t crypto_tests[] = {
      "Non Secure Hash (SHA-224) interface"},
 #endif
     {&tfm_crypto_test_1012, "TFM_NS_CRYPTO_TEST_1012",
-     "Non Secure Hash (SHA-256) interface"},
+     "Non Secure Hash (SHA-256) interface", &hash_bench},
 #ifdef TFM_CRYPTO_TEST_ALG_SHA_384
     {&tfm_crypto_test_1013, "TFM_NS_CRYPTO_TEST_1013",
      "Non Secure Hash (SHA-384) interface"},
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -7,16 +7,33 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include "os_wrapper/delay.h"
 #include "os_wrapper/mutex.h"
+#include "os_wrapper/semaphore.h"
 #include "os_wrapper/thread.h"
+#include "os_wrapper/thread_pool.h"
 #include "os_wrapper/tick.h"
 #include "psa/client.h"
 #include "psa/internal_trusted_storage.h"
 #include "psa_manifest/sid.h"
 #include "test_framework_helpers.h"
+/*
+ * The RPC test framework forwards the PSA client calls of the host threads
+ * instead of the NS mailbox. The tests of the mailbox itself are not built.
+ */
+#if CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1
+#include "tfm_ns_mailbox.h"
+#include "tfm_ns_mailbox_stats.h"
 #include "tfm_ns_mailbox_test.h"
+#ifndef TFM_MULTI_CORE_NS_OS_MAILBOX_THREAD
+#include "tfm_ns_mailbox_batch.h"
+#endif
+#endif
 
-#if (NUM_MAILBOX_QUEUE_SLOT > 1)
+#if CONFIG_TFM_ERPC_TEST_FRAMEWORK == 1
+/* Number of host threads sharing the RPC client, besides the parent thread */
+#define NR_MULTI_CALL_CHILD                   4
+#elif (NUM_MAILBOX_QUEUE_SLOT > 1)
 /* Max number of child threads for multiple outstanding PSA client call test */
 #define NR_MULTI_CALL_CHILD                   (NUM_MAILBOX_QUEUE_SLOT * 2)
 #else
@@ -29,10 +46,22 @@
 /* Max number of test rounds */
 #define MAX_NR_LIGHT_TEST_ROUND               0x200
 #define MAX_NR_HEAVY_TEST_ROUND               0x20
+/* Number of high priority calls in the priority dispatch test */
+#define MAX_NR_PRIO_TEST_ROUND                0x40
+/*
+ * The low priority calls which may complete during a high priority call: the
+ * calls already in the queue slots, and the one the mailbox thread may hold
+ * while it waits for a free slot.
+ */
+#define MAX_NR_PRIO_OVERTAKEN                 (NUM_MAILBOX_QUEUE_SLOT + 1)
+/* Number of slot claims per thread in the slot bookkeeping contention test */
+#define MAX_NR_SLOT_TEST_ROUND                0x2000
 
 /* Default stack size for child thread */
 #define MULTI_CALL_LIGHT_TEST_STACK_SIZE      0x200
 #define MULTI_CALL_HEAVY_TEST_STACK_SIZE      0x300
+/* The pooled child threads run both lightweight and heavyweight tests */
+#define MULTI_CALL_POOL_STACK_SIZE            MULTI_CALL_HEAVY_TEST_STACK_SIZE
 
 /* Test UID copied from ITS test cases */
 #define TEST_UID_1                            2U
@@ -47,16 +76,42 @@ struct test_params {
     uint32_t nr_rounds;             /* The number of test rounds */
     uint32_t nr_calls;              /* The number of PSA client calls */
     void *mutex_handle;             /* Mutex to protect is_complete flag */
+    void *start_handle;             /* Semaphore to kick off child threads */
     enum test_status_t ret;         /* The test result */
     uint32_t total_ticks;           /* The total ticks cost to complete tests */
+    uint32_t nr_slot_claims;        /* The number of slot claims measured */
+    uint32_t lock_free_ticks;       /* The ticks cost by lock-free claims */
+    uint32_t irq_off_ticks;         /* The ticks cost by IRQ-off claims */
     bool is_complete;               /* Whether current test thread completes */
     bool is_parent;                 /* Whether executed in parent thread */
 };
 
+#if CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1
+/*
+ * Measure the latency of the PSA client calls with the test framework
+ * timestamp. Most calls complete within an RTOS tick.
+ */
+uint32_t tfm_ns_mailbox_stats_get_time(void)
+{
+    return test_framework_get_timestamp();
+}
+#endif
+
 /* List of tests */
 static void multi_client_call_light_test(struct test_result_t *ret);
 static void multi_client_call_heavy_test(struct test_result_t *ret);
 static void multi_client_call_ooo_test(struct test_result_t *ret);
+#if CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1
+static void multi_client_call_slot_test(struct test_result_t *ret);
+static void multi_client_call_wait_test(struct test_result_t *ret);
+#ifndef TFM_MULTI_CORE_NS_OS_MAILBOX_THREAD
+static void multi_client_call_batch_test(struct test_result_t *ret);
+#else
+static void multi_client_call_prio_test(struct test_result_t *ret);
+#endif
+#endif
+
+static void multi_call_pool_delete(void);
 
 static struct test_t multi_core_tests[] = {
     {&multi_client_call_light_test,
@@ -68,6 +123,23 @@ static struct test_t multi_core_tests[] = {
     {&multi_client_call_ooo_test,
      "MULTI_CLIENT_CALL_OOO_TEST",
      "Multiple outstanding NS PSA client calls test with out-of-order calls"},
+#if CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1
+    {&multi_client_call_slot_test,
+     "MULTI_CLIENT_CALL_SLOT_TEST",
+     "Concurrent claims of the NS mailbox queue slots"},
+    {&multi_client_call_wait_test,
+     "MULTI_CLIENT_CALL_WAIT_TEST",
+     "Round trip of NS PSA client calls with and without reply spinning"},
+#ifndef TFM_MULTI_CORE_NS_OS_MAILBOX_THREAD
+    {&multi_client_call_batch_test,
+     "MULTI_CLIENT_CALL_BATCH_TEST",
+     "NS PSA client calls submitted in batches"},
+#else
+    {&multi_client_call_prio_test,
+     "MULTI_CLIENT_CALL_PRIO_TEST",
+     "High priority NS PSA client calls under low priority flood"},
+#endif
+#endif
 };
 
 void register_testsuite_multi_core_ns_interface(
@@ -83,6 +155,41 @@ void register_testsuite_multi_core_ns_interface(
 
     set_testsuite("TF-M test cases for multi-core topology",
                   multi_core_tests, list_size, p_test_suite);
+
+    p_test_suite->cleanup = multi_call_pool_delete;
+}
+
+/* Worker threads reused as the child threads by all the tests */
+static struct os_wrapper_thread_pool_t multi_call_pool;
+
+/*
+ * Create the child threads at the first test, so that the thread creation does
+ * not add up to the cost of the PSA client calls measured by the tests.
+ */
+static uint8_t multi_call_pool_workers(uint32_t priority)
+{
+    if (!multi_call_pool.nr_workers) {
+        (void)os_wrapper_thread_pool_init(&multi_call_pool, NULL,
+                                          MULTI_CALL_POOL_STACK_SIZE,
+                                          priority, NR_MULTI_CALL_CHILD);
+    }
+
+    return multi_call_pool.nr_workers;
+}
+
+/* Stop the child threads once all the tests are complete */
+static void multi_call_pool_delete(void)
+{
+    if (multi_call_pool.nr_workers) {
+        (void)os_wrapper_thread_pool_delete(&multi_call_pool);
+    }
+}
+
+/* Wait for the signal to kick-off the test in a child thread */
+static void wait_child_thread_start(struct test_params *params)
+{
+    os_wrapper_semaphore_acquire(params->start_handle,
+                                 OS_WRAPPER_WAIT_FOREVER);
 }
 
 static void wait_child_thread_completion(struct test_params *params_array,
@@ -107,19 +214,23 @@ static void wait_child_thread_completion(struct test_params *params_array,
 
 static void multi_client_call_test(struct test_result_t *ret,
                                    os_wrapper_thread_func test_runner,
-                                   int32_t stack_size,
                                    int32_t nr_rounds,
                                    bool is_mixed)
 {
-    uint8_t i, nr_child;
+    uint8_t i, nr_child, nr_workers;
     void *current_thread_handle;
     uint32_t current_thread_priority, err, total_ticks, total_calls, avg_ticks;
-    void *mutex_handle;
-    void *child_ids[NR_MULTI_CALL_CHILD];
+    uint32_t nr_slot_claims, lock_free_ticks, irq_off_ticks;
+    void *mutex_handle, *start_handle;
+#if CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1
     struct ns_mailbox_stats_res_t stats_res;
+    struct ns_mailbox_percentile_t percentile;
+#endif
     struct test_params parent_params, params[NR_MULTI_CALL_CHILD];
 
+#if CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1
     tfm_ns_mailbox_tx_stats_reinit();
+#endif
 
     current_thread_handle = os_wrapper_thread_get_handle();
     if (!current_thread_handle) {
@@ -151,21 +262,31 @@ static void multi_client_call_test(struct test_result_t *ret,
         return;
     }
 
-    /* Create test threads one by one */
-    for (i = 0; i < NR_MULTI_CALL_CHILD; i++) {
+    /* One more token than the child threads, as it cannot be created empty */
+    start_handle = os_wrapper_semaphore_create(NR_MULTI_CALL_CHILD + 1, 0,
+                                               NULL);
+    if (!start_handle) {
+        os_wrapper_mutex_delete(mutex_handle);
+        TEST_FAIL("Failed to create a semaphore\r\n");
+        return;
+    }
+
+    nr_workers = multi_call_pool_workers(current_thread_priority);
+
+    /* Dispatch the test to the child threads one by one */
+    for (i = 0; i < nr_workers; i++) {
         params[i].parent_handle = current_thread_handle;
         params[i].child_idx = i;
         params[i].nr_rounds = nr_rounds;
         params[i].mutex_handle = mutex_handle;
+        params[i].start_handle = start_handle;
         params[i].is_complete = false;
         params[i].is_parent = false;
+        params[i].nr_slot_claims = 0;
 
-        child_ids[i] = os_wrapper_thread_new(NULL,
-                                             stack_size,
-                                             test_runner,
-                                             &params[i],
-                                             current_thread_priority);
-        if (!child_ids[i]) {
+        err = os_wrapper_thread_pool_dispatch(&multi_call_pool, test_runner,
+                                              &params[i]);
+        if (err == OS_WRAPPER_ERROR) {
             break;
         }
     }
@@ -181,11 +302,14 @@ static void multi_client_call_test(struct test_result_t *ret,
      * Try to make test threads to run together.
      */
     for (i = 0; i < nr_child; i++) {
-        os_wrapper_thread_set_flag(child_ids[i], TEST_CHILD_EVENT_FLAG(i));
+        os_wrapper_semaphore_release(start_handle);
     }
 
     /* Use current thread to execute a test instance */
     parent_params.child_idx = nr_child;
+    parent_params.nr_slot_claims = 0;
+    parent_params.lock_free_ticks = 0;
+    parent_params.irq_off_ticks = 0;
     parent_params.nr_rounds = nr_rounds;
     parent_params.is_parent = true;
     test_runner(&parent_params);
@@ -193,6 +317,7 @@ static void multi_client_call_test(struct test_result_t *ret,
     /* Wait for all the test threads completes */
     wait_child_thread_completion(params, nr_child);
 
+    os_wrapper_semaphore_delete(start_handle);
     os_wrapper_mutex_delete(mutex_handle);
 
     if (parent_params.ret != TEST_PASSED) {
@@ -202,6 +327,9 @@ static void multi_client_call_test(struct test_result_t *ret,
 
     total_ticks = parent_params.total_ticks;
     total_calls = parent_params.nr_calls;
+    nr_slot_claims = parent_params.nr_slot_claims;
+    lock_free_ticks = parent_params.lock_free_ticks;
+    irq_off_ticks = parent_params.irq_off_ticks;
 
     /* Check the test result of each child thread */
     for (i = 0; i < nr_child; i++) {
@@ -212,13 +340,44 @@ static void multi_client_call_test(struct test_result_t *ret,
 
         total_ticks += params[i].total_ticks;
         total_calls += params[i].nr_calls;
+
+        if (params[i].nr_slot_claims) {
+            nr_slot_claims += params[i].nr_slot_claims;
+            lock_free_ticks += params[i].lock_free_ticks;
+            irq_off_ticks += params[i].irq_off_ticks;
+        }
     }
 
-    tfm_ns_mailbox_stats_avg_slot(&stats_res);
+#if CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1
     TEST_LOG("Totally %d NS mailbox queue slots\r\n", NUM_MAILBOX_QUEUE_SLOT);
+#endif
+
+    if (nr_slot_claims) {
+        TEST_LOG("%d concurrent slot claims cost %d ticks lock-free, "
+                 "%d ticks with IRQs disabled\r\n",
+                 nr_slot_claims, lock_free_ticks, irq_off_ticks);
+    }
+
+    if (!total_calls) {
+        ret->val = TEST_PASSED;
+        return;
+    }
+
+#if CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1
+    tfm_ns_mailbox_stats_avg_slot(&stats_res);
     TEST_LOG("%d.%d NS mailbox queue slots are occupied each time in average.\r\n",
              stats_res.avg_nr_slots, stats_res.avg_nr_slots_tenths);
 
+    tfm_ns_mailbox_stats_queue_depth(&percentile);
+    TEST_LOG("Occupied queue slots: p50 %d, p99 %d, max %d\r\n",
+             percentile.p50, percentile.p99, percentile.max);
+
+    tfm_ns_mailbox_stats_latency(&percentile);
+    TEST_LOG("Latency of %d PSA client calls: p50 %d, p99 %d, max %d %s\r\n",
+             percentile.nr_samples, percentile.p50, percentile.p99,
+             percentile.max, test_framework_get_timestamp_unit());
+#endif
+
     TEST_LOG("Cost %d ticks totally\r\n", total_ticks);
     avg_ticks = total_ticks / total_calls;
     total_ticks %= total_calls;
@@ -255,9 +414,7 @@ static void multi_client_call_light_runner(void *argument)
     struct test_params *params = (struct test_params *)argument;
 
     if (!params->is_parent) {
-        /* Wait for the signal to kick-off the test */
-        os_wrapper_thread_wait_flag(TEST_CHILD_EVENT_FLAG(params->child_idx),
-                                    OS_WRAPPER_WAIT_FOREVER);
+        wait_child_thread_start(params);
     }
 
     params->ret = multi_client_call_light_loop(params);
@@ -277,11 +434,134 @@ static void multi_client_call_light_runner(void *argument)
 static void multi_client_call_light_test(struct test_result_t *ret)
 {
     multi_client_call_test(ret, multi_client_call_light_runner,
-                           MULTI_CALL_LIGHT_TEST_STACK_SIZE,
                            MAX_NR_LIGHT_TEST_ROUND,
                            false);
 }
 
+#if CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1
+/*
+ * Claim and release a slot of the NS mailbox queue, either lock-free or in an
+ * IRQ-off critical section, to compare the cost of the slot bookkeeping when
+ * the test threads run concurrently. It fails if a slot is claimed by two
+ * threads at once.
+ *
+ * The slots of the single PSA client calls of the lightweight test are
+ * claimed by tfm_ns_mailbox.c of TF-M, whose bookkeeping cannot be switched,
+ * so the two ways are compared on the queue slots without any call.
+ */
+static enum test_status_t multi_client_call_slot_loop(struct test_params *params,
+                                                      bool lock_free)
+{
+    uint32_t i, start_ticks;
+    int32_t err;
+
+    start_ticks = os_wrapper_get_tick();
+
+    for (i = 0; i < params->nr_rounds; i++) {
+        do {
+            err = tfm_ns_mailbox_test_cycle_slot(lock_free);
+        } while (err == MAILBOX_QUEUE_FULL);
+
+        if (err == MAILBOX_GENERIC_ERROR) {
+            TEST_LOG("A NS mailbox queue slot was claimed twice\r\n");
+            return TEST_FAILED;
+        } else if (err != MAILBOX_SUCCESS) {
+            TEST_LOG("Failed to claim a NS mailbox queue slot\r\n");
+            return TEST_FAILED;
+        }
+    }
+
+    if (lock_free) {
+        params->lock_free_ticks = os_wrapper_get_tick() - start_ticks;
+    } else {
+        params->irq_off_ticks = os_wrapper_get_tick() - start_ticks;
+    }
+
+    return TEST_PASSED;
+}
+
+static void multi_client_call_slot_runner(void *argument)
+{
+    struct test_params *params = (struct test_params *)argument;
+
+    if (!params->is_parent) {
+        wait_child_thread_start(params);
+    }
+
+    /* No PSA client call, the slots are only claimed by the test threads */
+    params->total_ticks = 0;
+    params->nr_calls = 0;
+
+    params->ret = multi_client_call_slot_loop(params, true);
+    if (params->ret == TEST_PASSED) {
+        params->ret = multi_client_call_slot_loop(params, false);
+    }
+    params->nr_slot_claims = params->nr_rounds;
+
+    if (!params->is_parent) {
+        /* Mark this child thread has completed */
+        os_wrapper_mutex_acquire(params->mutex_handle, OS_WRAPPER_WAIT_FOREVER);
+        params->is_complete = true;
+        os_wrapper_mutex_release(params->mutex_handle);
+    }
+}
+
+/**
+ * \brief Claim and release the slots of the NS mailbox queue from all the test
+ *        threads concurrently, lock-free and with IRQs disabled.
+ */
+static void multi_client_call_slot_test(struct test_result_t *ret)
+{
+    multi_client_call_test(ret, multi_client_call_slot_runner,
+                           MAX_NR_SLOT_TEST_ROUND,
+                           false);
+}
+
+/* Average time of sequential lightweight calls */
+static bool multi_client_call_round_trip(uint32_t *time)
+{
+    uint32_t i, start;
+
+    start = test_framework_get_timestamp();
+
+    for (i = 0; i < MAX_NR_LIGHT_TEST_ROUND; i++) {
+        if (psa_framework_version() != PSA_FRAMEWORK_VERSION) {
+            return false;
+        }
+    }
+
+    *time = (test_framework_get_timestamp() - start) / MAX_NR_LIGHT_TEST_ROUND;
+
+    return true;
+}
+
+/**
+ * \brief Measure the round trip of lightweight PSA client calls when the
+ *        caller blocks at once for the reply, and when it spins first.
+ */
+static void multi_client_call_wait_test(struct test_result_t *ret)
+{
+    uint32_t block_time, spin_time;
+    bool is_ok;
+
+    tfm_ns_mailbox_test_wait_spin(false);
+    is_ok = multi_client_call_round_trip(&block_time);
+    tfm_ns_mailbox_test_wait_spin(true);
+
+    if (!is_ok || !multi_client_call_round_trip(&spin_time)) {
+        TEST_FAIL("Incorrect PSA framework version!\r\n");
+        return;
+    }
+
+    TEST_LOG("Round trip of a PSA client call: %d %s blocking, "
+             "%d %s spinning\r\n",
+             block_time, test_framework_get_timestamp_unit(),
+             spin_time, test_framework_get_timestamp_unit());
+
+    ret->val = TEST_PASSED;
+}
+#endif /* CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1 */
+
 static inline
 enum test_status_t multi_client_call_heavy_loop(const psa_storage_uid_t uid,
                                                 struct test_params *params)
@@ -329,9 +609,7 @@ static void multi_client_call_heavy_runner(void *argument)
     const psa_storage_uid_t uid = TEST_UID_1 + params->child_idx;
 
     if (!params->is_parent) {
-        /* Wait for the signal to kick-off the test */
-        os_wrapper_thread_wait_flag(TEST_CHILD_EVENT_FLAG(params->child_idx),
-                                    OS_WRAPPER_WAIT_FOREVER);
+        wait_child_thread_start(params);
     }
 
     params->ret = multi_client_call_heavy_loop(uid, params);
@@ -351,7 +629,6 @@ static void multi_client_call_heavy_runner(void *argument)
 static void multi_client_call_heavy_test(struct test_result_t *ret)
 {
     multi_client_call_test(ret, multi_client_call_heavy_runner,
-                           MULTI_CALL_HEAVY_TEST_STACK_SIZE,
                            MAX_NR_HEAVY_TEST_ROUND,
                            false);
 }
@@ -362,9 +639,7 @@ static void multi_client_call_ooo_runner(void *argument)
     const psa_storage_uid_t uid = TEST_UID_1 + params->child_idx;
 
     if (!params->is_parent) {
-        /* Wait for the signal to kick-off the test */
-        os_wrapper_thread_wait_flag(TEST_CHILD_EVENT_FLAG(params->child_idx),
-                                    OS_WRAPPER_WAIT_FOREVER);
+        wait_child_thread_start(params);
     }
 
     if (!params->child_idx % 2) {
@@ -389,7 +664,245 @@ static void multi_client_call_ooo_runner(void *argument)
 static void multi_client_call_ooo_test(struct test_result_t *ret)
 {
     multi_client_call_test(ret, multi_client_call_ooo_runner,
-                           MULTI_CALL_HEAVY_TEST_STACK_SIZE,
                            MAX_NR_HEAVY_TEST_ROUND,
                            true);
 }
+
+#if (CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1) && \
+    !defined(TFM_MULTI_CORE_NS_OS_MAILBOX_THREAD)
+/**
+ * \brief Submit lightweight PSA client calls in batches filling the whole NS
+ *        mailbox queue and check each reply.
+ */
+static void multi_client_call_batch_test(struct test_result_t *ret)
+{
+    struct ns_mailbox_batch_req_t reqs[NUM_MAILBOX_QUEUE_SLOT];
+    struct psa_client_params_t params = {0};
+    uint32_t i, j, total_ticks, total_calls, avg_ticks;
+    int32_t err;
+
+    for (i = 0; i < NUM_MAILBOX_QUEUE_SLOT; i++) {
+        reqs[i].call_type = MAILBOX_PSA_FRAMEWORK_VERSION;
+        reqs[i].params = &params;
+        reqs[i].client_id = 0;
+    }
+
+    total_ticks = os_wrapper_get_tick();
+
+    for (i = 0; i < MAX_NR_LIGHT_TEST_ROUND; i++) {
+        for (j = 0; j < NUM_MAILBOX_QUEUE_SLOT; j++) {
+            reqs[j].reply = 0;
+        }
+
+        err = tfm_ns_mailbox_client_call_batch(reqs, NUM_MAILBOX_QUEUE_SLOT);
+        if (err != MAILBOX_SUCCESS) {
+            TEST_FAIL("Failed to submit a batch of PSA client calls\r\n");
+            return;
+        }
+
+        for (j = 0; j < NUM_MAILBOX_QUEUE_SLOT; j++) {
+            if (reqs[j].reply != PSA_FRAMEWORK_VERSION) {
+                TEST_FAIL("Incorrect PSA framework version!\r\n");
+                return;
+            }
+        }
+    }
+
+    total_ticks = os_wrapper_get_tick() - total_ticks;
+    total_calls = MAX_NR_LIGHT_TEST_ROUND * NUM_MAILBOX_QUEUE_SLOT;
+
+    TEST_LOG("Batches of %d PSA client calls cost %d ticks totally\r\n",
+             NUM_MAILBOX_QUEUE_SLOT, total_ticks);
+    avg_ticks = total_ticks / total_calls;
+    total_ticks %= total_calls;
+    TEST_LOG("Each PSA client call cost %d.%d ticks in average\r\n", avg_ticks,
+             total_ticks * 10 / total_calls);
+
+    err = tfm_ns_mailbox_client_call_batch(reqs, NUM_MAILBOX_QUEUE_SLOT + 1);
+    if (err != MAILBOX_INVAL_PARAMS) {
+        TEST_FAIL("Oversized batch should be rejected\r\n");
+        return;
+    }
+
+    ret->val = TEST_PASSED;
+}
+#endif
+
+#if (CONFIG_TFM_ERPC_TEST_FRAMEWORK != 1) && \
+    defined(TFM_MULTI_CORE_NS_OS_MAILBOX_THREAD)
+/* Stop the low priority threads flooding the mailbox */
+static volatile bool prio_flood_stop;
+
+static void multi_client_call_flood_runner(void *argument)
+{
+    struct test_params *params = (struct test_params *)argument;
+    uint32_t nr_calls = 0;
+
+    /* Wait for the signal to kick-off the test */
+    os_wrapper_thread_wait_flag(TEST_CHILD_EVENT_FLAG(params->child_idx),
+                                OS_WRAPPER_WAIT_FOREVER);
+
+    params->ret = TEST_PASSED;
+
+    while (!prio_flood_stop) {
+        if (psa_framework_version() != PSA_FRAMEWORK_VERSION) {
+            params->ret = TEST_FAILED;
+            break;
+        }
+        nr_calls++;
+    }
+
+    params->nr_calls = nr_calls;
+
+    /* Mark this child thread has completed */
+    os_wrapper_mutex_acquire(params->mutex_handle, OS_WRAPPER_WAIT_FOREVER);
+    params->is_complete = true;
+    os_wrapper_mutex_release(params->mutex_handle);
+}
+
+/*
+ * The flooding threads have a lower priority than the current thread. Sleep
+ * instead of polling so that they can run to completion.
+ */
+static void wait_flood_thread_completion(struct test_params *params_array,
+                                         uint8_t nr_child, void *mutex)
+{
+    bool is_complete;
+    uint8_t i;
+
+    for (i = 0; i < nr_child; i++) {
+        while (1) {
+            os_wrapper_mutex_acquire(mutex, OS_WRAPPER_WAIT_FOREVER);
+            is_complete = params_array[i].is_complete;
+            os_wrapper_mutex_release(mutex);
+
+            if (is_complete) {
+                break;
+            }
+
+            os_wrapper_delay(1);
+        }
+    }
+}
+
+/**
+ * \brief Measure the latency of PSA client calls from the current thread while
+ *        lower priority threads keep the NS mailbox queue full, and check
+ *        that the queued low priority calls do not complete before them.
+ */
+static void multi_client_call_prio_test(struct test_result_t *ret)
+{
+    uint8_t i, nr_child;
+    void *current_thread_handle, *mutex_handle;
+    void *child_ids[NR_MULTI_CALL_CHILD];
+    uint32_t current_thread_priority, start, latency, nr_replies;
+    uint32_t max_latency = 0, total_latency = 0, nr_flood_calls = 0;
+    uint32_t nr_overtaken, max_overtaken = 0;
+    struct test_params params[NR_MULTI_CALL_CHILD];
+    enum test_status_t status = TEST_PASSED;
+
+    current_thread_handle = os_wrapper_thread_get_handle();
+    if (!current_thread_handle) {
+        TEST_FAIL("Failed to get current thread ID\r\n");
+        return;
+    }
+
+    if (os_wrapper_thread_get_priority(current_thread_handle,
+                                       &current_thread_priority) ==
+        OS_WRAPPER_ERROR) {
+        TEST_FAIL("Failed to get current thread priority\r\n");
+        return;
+    }
+
+    mutex_handle = os_wrapper_mutex_create();
+    if (!mutex_handle) {
+        TEST_FAIL("Failed to create a mutex\r\n");
+        return;
+    }
+
+    prio_flood_stop = false;
+
+    for (i = 0; i < NR_MULTI_CALL_CHILD; i++) {
+        params[i].child_idx = i;
+        params[i].mutex_handle = mutex_handle;
+        params[i].is_complete = false;
+        params[i].is_parent = false;
+
+        child_ids[i] = os_wrapper_thread_new(NULL,
+                                             MULTI_CALL_LIGHT_TEST_STACK_SIZE,
+                                             multi_client_call_flood_runner,
+                                             &params[i],
+                                             current_thread_priority - 1);
+        if (!child_ids[i]) {
+            break;
+        }
+    }
+
+    nr_child = i;
+    TEST_LOG("%d low priority threads flood the NS mailbox\r\n", nr_child);
+
+    for (i = 0; i < nr_child; i++) {
+        os_wrapper_thread_set_flag(child_ids[i], TEST_CHILD_EVENT_FLAG(i));
+    }
+
+    /* Let the flooding threads fill the mailbox queue */
+    os_wrapper_delay(1);
+
+    for (i = 0; i < MAX_NR_PRIO_TEST_ROUND; i++) {
+        nr_replies = tfm_ns_mailbox_stats_nr_replies();
+        start = test_framework_get_timestamp();
+        if (psa_framework_version() != PSA_FRAMEWORK_VERSION) {
+            TEST_LOG("Incorrect PSA framework version!\r\n");
+            status = TEST_FAILED;
+            break;
+        }
+        latency = test_framework_get_timestamp() - start;
+
+        /* The replies of the low priority calls before this one */
+        nr_overtaken = tfm_ns_mailbox_stats_nr_replies() - nr_replies;
+        if (nr_overtaken) {
+            nr_overtaken--;
+        }
+
+        total_latency += latency;
+        if (latency > max_latency) {
+            max_latency = latency;
+        }
+        if (nr_overtaken > max_overtaken) {
+            max_overtaken = nr_overtaken;
+        }
+    }
+
+    prio_flood_stop = true;
+    wait_flood_thread_completion(params, nr_child, mutex_handle);
+
+    os_wrapper_mutex_delete(mutex_handle);
+
+    for (i = 0; i < nr_child; i++) {
+        if (params[i].ret != TEST_PASSED) {
+            status = TEST_FAILED;
+        }
+        nr_flood_calls += params[i].nr_calls;
+    }
+
+    if (status != TEST_PASSED) {
+        ret->val = TEST_FAILED;
+        return;
+    }
+
+    TEST_LOG("High priority PSA client call latency: avg %d, max %d %s\r\n",
+             total_latency / MAX_NR_PRIO_TEST_ROUND, max_latency,
+             test_framework_get_timestamp_unit());
+    TEST_LOG("%d low priority PSA client calls meanwhile\r\n",
+             nr_flood_calls);
+    TEST_LOG("Up to %d low priority calls completed during a high priority "
+             "call\r\n", max_overtaken);
+
+    if (max_overtaken > MAX_NR_PRIO_OVERTAKEN) {
+        TEST_FAIL("Low priority calls overtook a high priority call\r\n");
+        return;
+    }
+
+    ret->val = TEST_PASSED;
+}
+#endif
@@ -1,11 +1,14 @@
 /*
- * Copyright (c) 2021-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
+#include <stddef.h>
 #include <stdint.h>
+#include "os_wrapper/semaphore.h"
+#include "os_wrapper/thread.h"
 #include "test_framework.h"
 #include "tfm_ns_client_ext.h"
 #include "nsid_svc_handler.h"
@@ -33,6 +36,16 @@
 #define INVALID_RESERVED_TOKEN_BIT    0x10000000
 #define TFM_NS_CONTEXT_MAX            1
 
+/*
+ * Number of threads created one after the other in the thread churn test.
+ * Much more than the thread IDs available to the TZ shim layer.
+ */
+#define NSID_CHURN_NR_THREADS         0x400
+#define NSID_CHURN_STACK_SIZE         0x200
+
+/* Number of round trips between two threads of the same NSID */
+#define NSID_SWITCH_NR_ROUNDS         0x40
+
 static uint8_t thread_id = 0x20;
 static int32_t nsid = -500;
 
@@ -962,6 +975,150 @@ static void tfm_nsid_test_case_21(struct test_result_t *ret)
     nsid_test_case_finish(ret);
 }
 
+static void *churn_semaphore;
+
+static void nsid_churn_thread(void *arg)
+{
+    (void)arg;
+
+    /* Release the semaphore to unblock the parent thread */
+    os_wrapper_semaphore_release(churn_semaphore);
+
+    /* The secure context and the thread ID of the thread are released */
+    os_wrapper_thread_exit();
+}
+
+/* Create and terminate threads beyond the number of thread IDs */
+static void tfm_nsid_test_case_22(struct test_result_t *ret)
+{
+    void *current_thread_handle;
+    uint32_t current_thread_priority;
+    uint32_t i;
+
+    current_thread_handle = os_wrapper_thread_get_handle();
+    if (!current_thread_handle) {
+        TEST_FAIL("Failed to get current thread ID\r\n");
+        return;
+    }
+
+    if (os_wrapper_thread_get_priority(current_thread_handle,
+                                       &current_thread_priority) ==
+        OS_WRAPPER_ERROR) {
+        TEST_FAIL("Failed to get current thread priority\r\n");
+        return;
+    }
+
+    churn_semaphore = os_wrapper_semaphore_create(1, 0, NULL);
+    if (!churn_semaphore) {
+        TEST_FAIL("Semaphore creation failed\r\n");
+        return;
+    }
+
+    for (i = 0; i < NSID_CHURN_NR_THREADS; i++) {
+        if (!os_wrapper_thread_new("Thread_C", NSID_CHURN_STACK_SIZE,
+                                   nsid_churn_thread, NULL,
+                                   current_thread_priority)) {
+            TEST_LOG("Thread %d of %d cannot be created\r\n", i,
+                     NSID_CHURN_NR_THREADS);
+            os_wrapper_semaphore_delete(churn_semaphore);
+            TEST_FAIL("Thread creation failed\r\n");
+            return;
+        }
+
+        os_wrapper_semaphore_acquire(churn_semaphore, OS_WRAPPER_WAIT_FOREVER);
+    }
+
+    os_wrapper_semaphore_delete(churn_semaphore);
+
+    ret->val = TEST_PASSED;
+}
+
+static void *switch_semaphores[2];
+static void *switch_done_semaphore;
+
+/* Hand over to the other thread of the same NSID, back and forth */
+static void nsid_switch_thread(void *arg)
+{
+    uint32_t idx = (uint32_t)(uintptr_t)arg;
+    uint32_t i;
+
+    for (i = 0; i < NSID_SWITCH_NR_ROUNDS; i++) {
+        os_wrapper_semaphore_acquire(switch_semaphores[idx],
+                                     OS_WRAPPER_WAIT_FOREVER);
+        os_wrapper_semaphore_release(switch_semaphores[idx ^ 1]);
+    }
+
+    os_wrapper_semaphore_release(switch_done_semaphore);
+
+    os_wrapper_thread_exit();
+}
+
+/* Count the secure context switches between threads of the same NSID */
+static void tfm_nsid_test_case_23(struct test_result_t *ret)
+{
+    struct nsid_mgr_ctx_stats_t start, end;
+    uint32_t current_thread_priority, nr_load_reqs, nr_loads;
+    uint32_t i;
+
+    if (os_wrapper_thread_get_priority(os_wrapper_thread_get_handle(),
+                                       &current_thread_priority) ==
+        OS_WRAPPER_ERROR) {
+        TEST_FAIL("Failed to get current thread priority\r\n");
+        return;
+    }
+
+    switch_semaphores[0] = os_wrapper_semaphore_create(1, 1, NULL);
+    switch_semaphores[1] = os_wrapper_semaphore_create(1, 0, NULL);
+    switch_done_semaphore = os_wrapper_semaphore_create(2, 0, NULL);
+    if (!switch_semaphores[0] || !switch_semaphores[1] ||
+        !switch_done_semaphore) {
+        TEST_FAIL("Semaphore creation failed\r\n");
+        return;
+    }
+
+    nsid_mgr_get_ctx_stats(&start);
+
+    for (i = 0; i < 2; i++) {
+        if (!os_wrapper_thread_new("Thread_D", NSID_CHURN_STACK_SIZE,
+                                   nsid_switch_thread, (void *)(uintptr_t)i,
+                                   current_thread_priority)) {
+            TEST_FAIL("Thread creation failed\r\n");
+            return;
+        }
+    }
+
+    for (i = 0; i < 2; i++) {
+        os_wrapper_semaphore_acquire(switch_done_semaphore,
+                                     OS_WRAPPER_WAIT_FOREVER);
+    }
+
+    nsid_mgr_get_ctx_stats(&end);
+
+    for (i = 0; i < 2; i++) {
+        os_wrapper_semaphore_delete(switch_semaphores[i]);
+    }
+    os_wrapper_semaphore_delete(switch_done_semaphore);
+
+    nr_load_reqs = end.nr_load_reqs - start.nr_load_reqs;
+    nr_loads = end.nr_loads - start.nr_loads;
+
+    TEST_LOG("%d secure context loads requested, %d entered SPE\r\n",
+             nr_load_reqs, nr_loads);
+    TEST_LOG("%d secure context stores requested, %d entered SPE\r\n",
+             end.nr_store_reqs - start.nr_store_reqs,
+             end.nr_stores - start.nr_stores);
+
+#ifdef TFM_NS_NSID_LAZY_CONTEXT
+    /* Each hand over between the two threads shall skip SPE */
+    if (nr_load_reqs - nr_loads < NSID_SWITCH_NR_ROUNDS) {
+        TEST_FAIL("Same NSID context switches shall not enter SPE\r\n");
+        return;
+    }
+#endif
+
+    ret->val = TEST_PASSED;
+}
+
 static struct test_t nsid_test_cases[] = {
     /* Normal test */
     {&tfm_nsid_test_case_1, "TFM_NS_NSID_TEST_1001",
@@ -1011,6 +1168,10 @@ static struct test_t nsid_test_cases[] = {
     /* Other tests */
     {&tfm_nsid_test_case_21, "TFM_NS_NSID_TEST_1021",
      "NSID management fail when called in thread mode"},
+    {&tfm_nsid_test_case_22, "TFM_NS_NSID_TEST_1022",
+     "NSID management thread ID reuse on thread churn"},
+    {&tfm_nsid_test_case_23, "TFM_NS_NSID_TEST_1023",
+     "NSID management context switches of the same NSID"},
 };
 
 void register_testsuite_nsid_test(struct test_suite_t *p_test_suite)
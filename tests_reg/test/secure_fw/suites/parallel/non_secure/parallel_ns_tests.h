@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __PARALLEL_NS_TESTS_H__
+#define __PARALLEL_NS_TESTS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "test_framework.h"
+
+/**
+ * \brief Register the first of the two test suites checking that test suites
+ *        run concurrently.
+ *
+ * \param[in] p_test_suite The test suite to be executed.
+ */
+void register_testsuite_ns_parallel_a(struct test_suite_t *p_test_suite);
+
+/**
+ * \brief Register the second of the two test suites checking that test suites
+ *        run concurrently. It must follow the first one in the list.
+ *
+ * \param[in] p_test_suite The test suite to be executed.
+ */
+void register_testsuite_ns_parallel_b(struct test_suite_t *p_test_suite);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PARALLEL_NS_TESTS_H__ */
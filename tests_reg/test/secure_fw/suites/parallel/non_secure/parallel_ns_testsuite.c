@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "parallel_ns_tests.h"
+#include "test_framework_parallel.h"
+#include "os_wrapper/semaphore.h"
+
+/* Ticks a test suite waits for the other one to be running */
+#define PARALLEL_TEST_TIMEOUT_TICKS    1000U
+
+/* Released by each test suite once it is running */
+static void *suite_a_running;
+static void *suite_b_running;
+
+static void tfm_parallel_test_1001(struct test_result_t *ret);
+static void tfm_parallel_test_2001(struct test_result_t *ret);
+
+static struct test_t parallel_a_tests[] = {
+    {&tfm_parallel_test_1001, "TFM_NS_PARALLEL_TEST_1001",
+     "Test suite A runs while test suite B is running"},
+};
+
+static struct test_t parallel_b_tests[] = {
+    {&tfm_parallel_test_2001, "TFM_NS_PARALLEL_TEST_2001",
+     "Test suite B runs while test suite A is running"},
+};
+
+void register_testsuite_ns_parallel_a(struct test_suite_t *p_test_suite)
+{
+    uint32_t list_size;
+
+    list_size = (sizeof(parallel_a_tests) / sizeof(parallel_a_tests[0]));
+
+    /* The test suites are registered before they are run */
+    if (suite_a_running == NULL) {
+        suite_a_running = os_wrapper_semaphore_create(1, 0, "parallel_a");
+    }
+    if (suite_b_running == NULL) {
+        suite_b_running = os_wrapper_semaphore_create(1, 0, "parallel_b");
+    }
+
+    set_testsuite("Parallel test suite A (TFM_NS_PARALLEL_TEST_1XXX)",
+                  parallel_a_tests, list_size, p_test_suite);
+}
+
+void register_testsuite_ns_parallel_b(struct test_suite_t *p_test_suite)
+{
+    uint32_t list_size;
+
+    list_size = (sizeof(parallel_b_tests) / sizeof(parallel_b_tests[0]));
+
+    set_testsuite("Parallel test suite B (TFM_NS_PARALLEL_TEST_2XXX)",
+                  parallel_b_tests, list_size, p_test_suite);
+}
+
+/*
+ * Signals that the calling test suite is running, then waits for the other
+ * one. If the test suites are run one after the other, the first one times
+ * out.
+ */
+static void rendezvous(void *own, void *other, struct test_result_t *ret)
+{
+#if TEST_FRAMEWORK_PARALLEL_WORKERS < 2
+    (void)own;
+    (void)other;
+
+    /* A single worker runs one test suite at a time */
+    ret->val = TEST_SKIPPED;
+#else
+    if ((own == NULL) || (other == NULL)) {
+        TEST_FAIL("Semaphore creation failed");
+        return;
+    }
+
+    os_wrapper_semaphore_release(own);
+
+    if (os_wrapper_semaphore_acquire(other, PARALLEL_TEST_TIMEOUT_TICKS) !=
+        OS_WRAPPER_SUCCESS) {
+        TEST_FAIL("The test suites did not run concurrently");
+        return;
+    }
+
+    ret->val = TEST_PASSED;
+#endif
+}
+
+/**
+ * \brief Waits for test suite B while test suite A is running.
+ */
+static void tfm_parallel_test_1001(struct test_result_t *ret)
+{
+    rendezvous(suite_a_running, suite_b_running, ret);
+}
+
+/**
+ * \brief Waits for test suite A while test suite B is running.
+ */
+static void tfm_parallel_test_2001(struct test_result_t *ret)
+{
+    rendezvous(suite_b_running, suite_a_running, ret);
+}
@@ -1,23 +1,76 @@
 /*
- * Copyright (c) 2018-2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
+#include <string.h>
+
 #include "ns_test_helpers.h"
 
 #include "thread.h"
+#include "thread_pool.h"
 #include "semaphore.h"
 
 #define PS_TEST_TASK_STACK_SIZE (768)
 
+/* The number of distinct thread names the tests run under */
+#define PS_TEST_NR_WORKERS      (3)
+
 struct test_task_t {
     test_func_t *func;
     struct test_result_t *ret;
 };
 
+/*
+ * The NSID of a thread is bound to its name when it is created. Each thread
+ * name gets its own worker, reused by all the tests run under that name until
+ * tfm_ps_test_cleanup() is called.
+ */
+struct test_worker_t {
+    const char *name;
+    struct os_wrapper_thread_pool_t pool;
+};
+
 static void *test_semaphore;
+static struct test_worker_t test_workers[PS_TEST_NR_WORKERS];
+
+/**
+ * \brief Gets the worker running the tests under the given thread name,
+ *        creating it on first use.
+ *
+ * \param[in] thread_name  Name of the worker thread
+ * \param[in] priority     Priority of the worker thread
+ *
+ * \return Returns the worker pool, or NULL in case of error
+ */
+static struct os_wrapper_thread_pool_t *get_test_worker(const char *thread_name,
+                                                        uint32_t priority)
+{
+    struct test_worker_t *worker;
+    uint32_t i;
+
+    for (i = 0; i < PS_TEST_NR_WORKERS; i++) {
+        worker = &test_workers[i];
+
+        if (!worker->name) {
+            if (os_wrapper_thread_pool_init(&worker->pool, thread_name,
+                                            PS_TEST_TASK_STACK_SIZE, priority,
+                                            1) != OS_WRAPPER_SUCCESS) {
+                return NULL;
+            }
+            worker->name = thread_name;
+            return &worker->pool;
+        }
+
+        if (!strcmp(worker->name, thread_name)) {
+            return &worker->pool;
+        }
+    }
+
+    return NULL;
+}
 
 /**
  * \brief Executes the supplied test task and then releases the test semaphore.
@@ -35,8 +88,7 @@ static void test_task_runner(void *arg)
     /* Release the semaphore to unblock the parent thread */
     os_wrapper_semaphore_release(test_semaphore);
 
-    /* Signal to the RTOS that the thread is finished */
-    os_wrapper_thread_exit();
+    /* Return to the worker, which waits for the next test */
 }
 
 void tfm_ps_run_test(const char *thread_name, struct test_result_t *ret,
@@ -45,7 +97,7 @@ void tfm_ps_run_test(const char *thread_name, struct test_result_t *ret,
     void *current_thread_handle;
     uint32_t current_thread_priority;
     uint32_t err;
-    void *thread;
+    struct os_wrapper_thread_pool_t *worker;
     struct test_task_t test_task = { .func = test_func, .ret = ret };
 
     /* Create a binary semaphore with initial count of 0 tokens available */
@@ -70,16 +122,22 @@ void tfm_ps_run_test(const char *thread_name, struct test_result_t *ret,
         return;
     }
 
-    /* Start test thread */
-    thread = os_wrapper_thread_new(thread_name, PS_TEST_TASK_STACK_SIZE,
-                                   test_task_runner, &test_task,
-                                   current_thread_priority);
-    if (!thread) {
+    /* Run the test in the worker thread of that name */
+    worker = get_test_worker(thread_name, current_thread_priority);
+    if (!worker) {
         os_wrapper_semaphore_delete(test_semaphore);
         TEST_FAIL("Failed to create test thread");
         return;
     }
 
+    err = os_wrapper_thread_pool_dispatch(worker, test_task_runner,
+                                          &test_task);
+    if (err == OS_WRAPPER_ERROR) {
+        os_wrapper_semaphore_delete(test_semaphore);
+        TEST_FAIL("Failed to start test task");
+        return;
+    }
+
     /* Signal semaphore, wait indefinitely until unblocked by child thread */
     err = os_wrapper_semaphore_acquire(test_semaphore, OS_WRAPPER_WAIT_FOREVER);
 
@@ -91,3 +149,15 @@ void tfm_ps_run_test(const char *thread_name, struct test_result_t *ret,
 
     os_wrapper_semaphore_delete(test_semaphore);
 }
+
+void tfm_ps_test_cleanup(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < PS_TEST_NR_WORKERS; i++) {
+        if (test_workers[i].name) {
+            (void)os_wrapper_thread_pool_delete(&test_workers[i].pool);
+            test_workers[i].name = NULL;
+        }
+    }
+}
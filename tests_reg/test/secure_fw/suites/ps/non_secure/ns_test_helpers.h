@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -49,6 +49,11 @@ typedef void test_func_t(struct test_result_t *ret);
 void tfm_ps_run_test(const char *thread_name, struct test_result_t *ret,
                      test_func_t *test_func);
 
+/**
+ * \brief Stops the threads created by \ref tfm_ps_run_test.
+ */
+void tfm_ps_test_cleanup(void);
+
 #ifdef __cplusplus
 }
 #endif
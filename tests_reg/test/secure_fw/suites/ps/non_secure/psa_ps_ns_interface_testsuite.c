@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -138,6 +138,8 @@ void register_testsuite_ns_psa_ps_interface(struct test_suite_t *p_test_suite)
 
     set_testsuite("PSA protected storage NS interface tests (TFM_NS_PS_TEST_1XXX)",
                   psa_ps_ns_tests, list_size, p_test_suite);
+
+    p_test_suite->cleanup = tfm_ps_test_cleanup;
 }
 
 /**
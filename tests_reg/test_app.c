@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -27,6 +27,7 @@ void test_app(void *argument)
 
     /* Output EOT char for test environments like FVP. */
     LOG_MSG("\x04");
+    LOG_FLUSH();
 
     /* End of test */
     os_wrapper_thread_exit();
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+#-------------------------------------------------------------------------------
+# Copyright (c) 2026, Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+#-------------------------------------------------------------------------------
+
+"""
+Format back the log messages recorded by the deferred NS logger.
+
+With TFM_NS_LOG_DEFERRED, a message with arguments is output as a line made of
+'@TL ' and the words of its record in hex: the address of the format string
+followed by the raw arguments. The format strings are read from the ELF image
+of the NS application, so the image must be the one which produced the log.
+Anything else in the log is copied unchanged.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+RECORD_RE = re.compile(r'@TL ((?:[0-9a-f]{8} )*[0-9a-f]{8})\r?\n')
+
+PT_LOAD = 1
+
+
+class ElfImage:
+    """Loadable segments of an ELF image, addressed by virtual address"""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            data = f.read()
+
+        if data[:4] != b'\x7fELF':
+            raise ValueError('{} is not an ELF file'.format(path))
+
+        is_64 = data[4] == 2
+        self.endian = '<' if data[5] == 1 else '>'
+        self.long_size = 8 if is_64 else 4
+
+        if is_64:
+            phoff, = struct.unpack_from(self.endian + 'Q', data, 0x20)
+            phentsize, phnum = struct.unpack_from(self.endian + 'HH', data,
+                                                  0x36)
+            ph_fmt = 'IIQQQQQQ'
+        else:
+            phoff, = struct.unpack_from(self.endian + 'I', data, 0x1C)
+            phentsize, phnum = struct.unpack_from(self.endian + 'HH', data,
+                                                  0x2A)
+            ph_fmt = 'IIIIIIII'
+
+        self.segments = []
+        for i in range(phnum):
+            fields = struct.unpack_from(self.endian + ph_fmt, data,
+                                        phoff + i * phentsize)
+            if is_64:
+                p_type, _, p_offset, p_vaddr, _, p_filesz = fields[:6]
+            else:
+                p_type, p_offset, p_vaddr, _, p_filesz = fields[:5]
+            if p_type == PT_LOAD and p_filesz:
+                self.segments.append(
+                    (p_vaddr, data[p_offset:p_offset + p_filesz]))
+
+    def read_string(self, addr):
+        for base, content in self.segments:
+            if base <= addr < base + len(content):
+                end = content.find(b'\0', addr - base)
+                if end < 0:
+                    end = len(content)
+                return content[addr - base:end].decode('latin-1')
+        return None
+
+
+SPEC_RE = re.compile(r'([-0]*)(\*|[0-9]*)(ll|l|z)?')
+
+
+def pad_field(body, prefix='', left=False, zero=False, width=0):
+    """Pad a conversion to the field width the same way as tfm_log_printf()"""
+    pad = max(width - len(prefix) - len(body), 0)
+    if left:
+        return prefix + body + ' ' * pad
+    if zero:
+        return prefix + '0' * pad + body
+    return ' ' * pad + prefix + body
+
+
+def format_record(image, words):
+    """Format a record the same way as tfm_log_printf()"""
+    fmt_addr, args = words[0], words[1:]
+
+    if fmt_addr == 0:
+        return '[{} log messages dropped]\r\n'.format(args[0] if args else 0)
+
+    fmt = image.read_string(fmt_addr)
+    if fmt is None:
+        return '[Unknown format string 0x{:08x}]\r\n'.format(fmt_addr)
+
+    def next_int(length='', signed=False):
+        size = {'ll': 8, 'l': image.long_size, 'z': image.long_size}.get(length,
+                                                                          4)
+        value = 0
+        for i in range(size // 4):
+            value |= (args.pop(0) if args else 0) << (32 * i)
+        if signed and value >> (size * 8 - 1):
+            value -= 1 << (size * 8)
+        return value
+
+    def next_bytes(length):
+        raw = b''
+        while args and len(raw) < length:
+            raw += struct.pack(image.endian + 'I', args.pop(0))
+        return raw[:length]
+
+    out = []
+    i = 0
+    while i < len(fmt):
+        c = fmt[i]
+        i += 1
+        if c != '%':
+            out.append(c)
+            continue
+
+        spec = SPEC_RE.match(fmt, i)
+        i = spec.end()
+        flags, width, length = spec.group(1), spec.group(2), spec.group(3)
+        field = {'left': '-' in flags, 'zero': '0' in flags}
+        if width == '*':
+            width = next_int(signed=True)
+            if width < 0:
+                field['left'] = True
+                width = -width
+        field['width'] = int(width or 0)
+
+        tag = fmt[i] if i < len(fmt) else ''
+        if tag in ('d', 'i'):
+            value = next_int(length, signed=True)
+            out.append(pad_field(str(abs(value)),
+                                 '-' if value < 0 else '', **field))
+        elif tag == 'u':
+            out.append(pad_field(str(next_int(length)), **field))
+        elif tag == 'x':
+            out.append(pad_field('{:x}'.format(next_int(length)), **field))
+        elif tag == 'X':
+            out.append(pad_field('{:X}'.format(next_int(length)), **field))
+        elif tag == 'p' and fmt[i + 1:i + 2] == 'h':
+            i += 1
+            sep = ' '
+            if fmt[i + 1:i + 2] in ('C', 'D', 'N'):
+                i += 1
+                sep = {'C': ':', 'D': '-', 'N': ''}[fmt[i]]
+            if spec.group(2) != '*':
+                field['width'] = next_int()
+            out.append(sep.join('{:02x}'.format(b)
+                                for b in next_bytes(field['width'])))
+        elif tag == 'p':
+            out.append(pad_field('{:x}'.format(next_int()), '0x', **field))
+        elif tag == 'c':
+            field['zero'] = False
+            out.append(pad_field(chr(next_int() & 0xFF), **field))
+        elif tag == 's':
+            raw = b''
+            while args:
+                word = struct.pack(image.endian + 'I', args.pop(0))
+                raw += word
+                if b'\0' in word:
+                    break
+            field['zero'] = False
+            out.append(pad_field(raw.split(b'\0')[0].decode('latin-1'),
+                                 **field))
+        elif tag == '%':
+            out.append('%')
+        else:
+            # The character after an unsupported tag is output as is
+            out.append('[Unsupported Tag]')
+            continue
+        i += 1
+
+    return ''.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Format back the deferred NS log messages')
+    parser.add_argument('elf', help='ELF image of the NS application')
+    parser.add_argument('log', nargs='?', default='-',
+                        help='Captured log, standard input by default')
+    args = parser.parse_args()
+
+    image = ElfImage(args.elf)
+
+    if args.log == '-':
+        text = sys.stdin.buffer.read().decode('latin-1')
+    else:
+        with open(args.log, 'rb') as f:
+            text = f.read().decode('latin-1')
+
+    def decode(match):
+        words = [int(w, 16) for w in match.group(1).split()]
+        return format_record(image, words)
+
+    sys.stdout.write(RECORD_RE.sub(decode, text))
+
+
+if __name__ == '__main__':
+    main()
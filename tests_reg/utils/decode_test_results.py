@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+#-------------------------------------------------------------------------------
+# Copyright (c) 2026, Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+#-------------------------------------------------------------------------------
+
+"""
+Decode the machine-readable result stream of the regression test framework.
+
+The stream is enabled with TEST_FRAMEWORK_RESULT_STREAM. Each record is a line
+starting with '@TR ' followed by a JSON object. Any other line, such as the log
+messages printed by the tests themselves, is ignored.
+
+The decoder prints a summary of the runs, can write a JUnit XML report and
+exits with a non-zero status if any test failed or a run did not complete.
+"""
+
+import argparse
+import json
+import sys
+import xml.etree.ElementTree as ET
+
+RECORD_PREFIX = '@TR '
+
+
+class Run:
+    def __init__(self, suite_type, unit):
+        self.suite_type = suite_type
+        self.unit = unit
+        self.suites = {}
+        self.status = None
+        self.errors = []
+
+
+class Suite:
+    def __init__(self, suite_id, name):
+        self.suite_id = suite_id
+        self.name = name
+        self.tests = []
+        self.benches = []
+        self.status = None
+        self.elapsed = None
+
+
+def parse_records(lines):
+    """Yield the decoded records found in the input lines"""
+    for line_no, line in enumerate(lines, 1):
+        idx = line.find(RECORD_PREFIX)
+        if idx < 0:
+            continue
+        try:
+            yield json.loads(line[idx + len(RECORD_PREFIX):].strip())
+        except json.JSONDecodeError:
+            print('Warning: corrupted record on line {}'.format(line_no),
+                  file=sys.stderr)
+
+
+def get_suite(run, suite_id):
+    """Return the suite of a record, even if its start record was not captured"""
+    if suite_id not in run.suites:
+        run.suites[suite_id] = Suite(suite_id, 'unknown (#{})'.format(suite_id))
+    return run.suites[suite_id]
+
+
+def decode(lines):
+    runs = []
+    run = None
+
+    for rec in parse_records(lines):
+        ev = rec.get('ev')
+        if ev == 'run':
+            run = Run(rec.get('type'), rec.get('unit'))
+            runs.append(run)
+            continue
+        if run is None:
+            # Records before the first run start, e.g. a partial capture
+            run = Run('unknown', None)
+            runs.append(run)
+        if ev == 'suite':
+            run.suites[rec['suite']] = Suite(rec['suite'], rec['name'])
+        elif ev == 'test':
+            get_suite(run, rec.get('suite')).tests.append(rec)
+        elif ev == 'bench':
+            get_suite(run, rec.get('suite')).benches.append(rec)
+        elif ev == 'suite_end':
+            suite = get_suite(run, rec.get('suite'))
+            suite.status = rec['status']
+            suite.elapsed = rec.get('elapsed')
+        elif ev == 'end':
+            run.status = rec['status']
+        elif ev == 'error':
+            run.errors.append(rec.get('msg', ''))
+
+    return runs
+
+
+def print_summary(runs):
+    for run in runs:
+        unit = run.unit or ''
+        print('*** {} test suites ***'.format(run.suite_type))
+        for suite in run.suites.values():
+            elapsed = ''
+            if run.unit and suite.elapsed is not None:
+                elapsed = ' ({} {})'.format(suite.elapsed, unit)
+            print("Test suite '{}' has {}{}".format(suite.name,
+                                                   suite.status or 'NOT COMPLETED',
+                                                   elapsed))
+            for test in suite.tests:
+                if test['status'] != 'FAILED':
+                    continue
+                where = ''
+                if 'file' in test:
+                    where = ' ({}:{})'.format(test['file'], test['line'])
+                print('  {} - FAILED: {}{}'.format(test['name'],
+                                                   test.get('msg', ''), where))
+            for bench in suite.benches:
+                print('  {} - min/median/mean/p99/max: {}/{}/{}/{}/{} {}'.format(
+                      bench['name'], bench['min'], bench['median'],
+                      bench['mean'], bench['p99'], bench['max'], unit))
+        for err in run.errors:
+            print('Error ( {} )'.format(err))
+        print('Run status: {}'.format(run.status or 'NOT COMPLETED'))
+
+
+def write_junit(runs, path):
+    root = ET.Element('testsuites')
+    for run in runs:
+        # JUnit times are in seconds, only convert known units
+        scale = {'us': 1e-6}.get(run.unit)
+        for suite in run.suites.values():
+            failures = [t for t in suite.tests if t['status'] == 'FAILED']
+            skipped = [t for t in suite.tests if t['status'] == 'SKIPPED']
+            ts = ET.SubElement(root, 'testsuite', name=suite.name,
+                               tests=str(len(suite.tests)),
+                               failures=str(len(failures)),
+                               skipped=str(len(skipped)))
+            for test in suite.tests:
+                tc = ET.SubElement(ts, 'testcase', name=test['name'],
+                                   classname=run.suite_type or '')
+                if scale is not None:
+                    tc.set('time', str(test['elapsed'] * scale))
+                if test['status'] == 'FAILED':
+                    fail = ET.SubElement(tc, 'failure',
+                                         message=test.get('msg', ''))
+                    if 'file' in test:
+                        fail.text = '{}:{}'.format(test['file'], test['line'])
+                elif test['status'] == 'SKIPPED':
+                    ET.SubElement(tc, 'skipped')
+    ET.ElementTree(root).write(path, encoding='utf-8', xml_declaration=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('log', nargs='?', default='-',
+                        help='Captured UART log, or - for stdin (default)')
+    parser.add_argument('--junit', metavar='FILE',
+                        help='Write a JUnit XML report to FILE')
+    args = parser.parse_args()
+
+    if args.log == '-':
+        runs = decode(sys.stdin)
+    else:
+        with open(args.log, errors='replace') as f:
+            runs = decode(f)
+
+    if not runs:
+        print('No test result record found', file=sys.stderr)
+        return 1
+
+    print_summary(runs)
+
+    if args.junit:
+        write_junit(runs, args.junit)
+
+    for run in runs:
+        if run.status != 'PASSED':
+            return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())